@@ -0,0 +1,201 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongAlgorithms.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+template <typename T>
+struct ValueConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+template <typename T>
+using Value = StrongType<ValueConfig<T>>;
+
+template <typename T>
+auto makeValues(std::size_t count) -> std::vector<Value<T>> {
+  std::mt19937_64 random{42};
+  std::vector<Value<T>> values;
+  values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    values.emplace_back(static_cast<T>(random() % 1'000'000));
+  }
+  return values;
+}
+
+template <typename T>
+void setBytes(benchmark::State& state) {
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(Value<T>)));
+}
+
+// The scalar variants are the loops one would write without the kernels, they
+// go through the StrongType operators element by element
+template <typename T>
+void BM_Scalar_CountEqual(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> needle{static_cast<T>(4242)};
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& value : values) {
+      count += value == needle ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Simd_CountEqual(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> needle{static_cast<T>(4242)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        strong::count_equal(std::span<const Value<T>>{values}, needle));
+  }
+  setBytes<T>(state);
+}
+
+// no element is below the pivot, so the whole range is scanned
+template <typename T>
+void BM_Scalar_FindIfLess(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> pivot{T{0}};
+  for (auto _ : state) {
+    auto it = values.begin();
+    while (it != values.end() && !(*it < pivot)) {
+      ++it;
+    }
+    benchmark::DoNotOptimize(it);
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Simd_FindIfLess(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> pivot{T{0}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        strong::find_if_less(std::span<const Value<T>>{values}, pivot));
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Scalar_CompareMask(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> pivot{static_cast<T>(500'000)};
+  std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+  for (auto _ : state) {
+    std::fill(mask.begin(), mask.end(), 0);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      mask[i / 64] |= static_cast<std::uint64_t>(values[i] < pivot ? 1 : 0)
+                      << (i % 64);
+    }
+    benchmark::DoNotOptimize(mask.data());
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Simd_CompareMask(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  const Value<T> pivot{static_cast<T>(500'000)};
+  std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+  for (auto _ : state) {
+    strong::compare_mask(std::span<const Value<T>>{values}, pivot,
+                         std::less<>{}, std::span{mask});
+    benchmark::DoNotOptimize(mask.data());
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Scalar_MinElement(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::min_element(values.begin(), values.end()));
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Simd_MinElement(benchmark::State& state) {
+  const auto values = makeValues<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::min_element(values));
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+struct RangeConfig : ValueConfig<T> {
+  using validator = strong::InRange<T{0}, T{1'000'000}>;
+};
+template <typename T>
+using RangeValue = StrongType<RangeConfig<T>>;
+
+template <typename T>
+auto makeRaw(std::size_t count) -> std::vector<T> {
+  std::vector<T> raw;
+  raw.reserve(count);
+  for (const auto& value : makeValues<T>(count)) {
+    raw.push_back(value.get());
+  }
+  return raw;
+}
+
+// what the validating constructor does for every element of a column
+template <typename T>
+void BM_Scalar_Validate(benchmark::State& state) {
+  const auto raw = makeRaw<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t i = 0;
+    while (i < raw.size() && RangeConfig<T>::validator::isValid(raw[i])) {
+      ++i;
+    }
+    benchmark::DoNotOptimize(i);
+  }
+  setBytes<T>(state);
+}
+
+template <typename T>
+void BM_Simd_Validate(benchmark::State& state) {
+  const auto raw = makeRaw<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::find_invalid<RangeValue<T>>(raw));
+  }
+  setBytes<T>(state);
+}
+}  // namespace
+
+// 16K elements stay in L1/L2, 16M elements are bound by memory bandwidth
+#define STRONG_ALGORITHM_BENCHMARK(name)                 \
+  BENCHMARK(name<std::int64_t>)->Range(1 << 14, 1 << 24); \
+  BENCHMARK(name<float>)->Range(1 << 14, 1 << 24)
+
+STRONG_ALGORITHM_BENCHMARK(BM_Scalar_CountEqual);
+STRONG_ALGORITHM_BENCHMARK(BM_Simd_CountEqual);
+STRONG_ALGORITHM_BENCHMARK(BM_Scalar_FindIfLess);
+STRONG_ALGORITHM_BENCHMARK(BM_Simd_FindIfLess);
+STRONG_ALGORITHM_BENCHMARK(BM_Scalar_CompareMask);
+STRONG_ALGORITHM_BENCHMARK(BM_Simd_CompareMask);
+STRONG_ALGORITHM_BENCHMARK(BM_Scalar_MinElement);
+STRONG_ALGORITHM_BENCHMARK(BM_Simd_MinElement);
+STRONG_ALGORITHM_BENCHMARK(BM_Scalar_Validate);
+STRONG_ALGORITHM_BENCHMARK(BM_Simd_Validate);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+template <typename T>
+struct QuantityConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+
+  static constexpr bool addSubtract = true;
+  static constexpr bool scale = true;
+};
+template <typename T>
+using Quantity = StrongType<QuantityConfig<T>>;
+
+constexpr std::size_t elements = 1 << 16;
+
+// Raw and strong variants of the same loops, they should compile to the same
+// instructions and therefore report the same throughput
+template <typename T>
+void BM_Raw_AddScale(benchmark::State& state) {
+  std::vector<T> values(elements, T{3});
+  const T factor{2};
+  for (auto _ : state) {
+    T sum{0};
+    for (const auto& value : values) {
+      sum = sum + value * factor;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_Strong_AddScale(benchmark::State& state) {
+  std::vector<Quantity<T>> values(elements, Quantity<T>{T{3}});
+  const T factor{2};
+  for (auto _ : state) {
+    Quantity<T> sum{T{0}};
+    for (const auto& value : values) {
+      sum = sum + value * factor;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_Raw_InPlace(benchmark::State& state) {
+  std::vector<T> values(elements, T{3});
+  const T delta{1};
+  for (auto _ : state) {
+    for (auto& value : values) {
+      value += delta;
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_Strong_InPlace(benchmark::State& state) {
+  std::vector<Quantity<T>> values(elements, Quantity<T>{T{3}});
+  const Quantity<T> delta{T{1}};
+  for (auto _ : state) {
+    for (auto& value : values) {
+      value += delta;
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+}  // namespace
+
+BENCHMARK(BM_Raw_AddScale<int>);
+BENCHMARK(BM_Strong_AddScale<int>);
+BENCHMARK(BM_Raw_AddScale<std::int64_t>);
+BENCHMARK(BM_Strong_AddScale<std::int64_t>);
+BENCHMARK(BM_Raw_AddScale<double>);
+BENCHMARK(BM_Strong_AddScale<double>);
+BENCHMARK(BM_Raw_InPlace<int>);
+BENCHMARK(BM_Strong_InPlace<int>);
+BENCHMARK(BM_Raw_InPlace<std::int64_t>);
+BENCHMARK(BM_Strong_InPlace<std::int64_t>);
+BENCHMARK(BM_Raw_InPlace<double>);
+BENCHMARK(BM_Strong_InPlace<double>);
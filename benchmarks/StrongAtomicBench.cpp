@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongAtomic.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace {
+struct CountConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool addSubtract = true;
+};
+using Count = StrongType<CountConfig>;
+
+constexpr int maxThreads = 8;
+
+// the former approaches: a mutex or a CAS loop on std::atomic<StrongType>
+std::mutex mutex;
+Count lockedCount;
+std::atomic<Count> casCount;
+StrongAtomic<CountConfig> sharedCount;
+std::array<StrongAtomic<CountConfig>, maxThreads> adjacentCounts;
+std::array<StrongPaddedAtomic<CountConfig>, maxThreads> paddedCounts;
+StrongShardedCounter<CountConfig> shardedCount{maxThreads};
+
+void BM_MutexAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    const std::scoped_lock lock{mutex};
+    lockedCount += Count{1};
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_CasLoopAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    auto current = casCount.load(std::memory_order_relaxed);
+    while (!casCount.compare_exchange_weak(current, current + Count{1},
+                                           std::memory_order_relaxed)) {
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FetchAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    sharedCount.fetch_add(Count{1}, std::memory_order_relaxed);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// every thread has its own counter, but they share cache lines
+void BM_AdjacentAdd(benchmark::State& state) {
+  auto& count = adjacentCounts[static_cast<std::size_t>(state.thread_index())];
+  for (auto _ : state) {
+    count.fetch_add(Count{1}, std::memory_order_relaxed);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PaddedAdd(benchmark::State& state) {
+  auto& count = paddedCounts[static_cast<std::size_t>(state.thread_index())];
+  for (auto _ : state) {
+    count.fetch_add(Count{1}, std::memory_order_relaxed);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ShardedAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    shardedCount.add(Count{1});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FetchMax(benchmark::State& state) {
+  std::int64_t value = state.thread_index();
+  for (auto _ : state) {
+    sharedCount.fetch_max(Count{value});
+    value += state.threads();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_MutexAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_CasLoopAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_FetchAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_AdjacentAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_PaddedAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_ShardedAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_FetchMax)->ThreadRange(1, maxThreads)->UseRealTime();
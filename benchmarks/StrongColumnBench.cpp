@@ -0,0 +1,164 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongColumn.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+struct StoredIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using StoredId = StrongType<StoredIdConfig>;
+
+// 16M ids by default, e.g. STRONGTYPES_COLUMN_SIZE=1000000000 for 1B ids
+// (an 8 GB file)
+auto columnSize() -> std::int64_t {
+  const char* size = std::getenv("STRONGTYPES_COLUMN_SIZE");
+  return size == nullptr ? std::int64_t{1} << 24 : std::atoll(size);
+}
+
+auto columnPath() -> const std::filesystem::path& {
+  static const auto path =
+      std::filesystem::temp_directory_path() / "StrongColumnBench.col";
+  return path;
+}
+
+// written in chunks, so 1B ids don't have to fit in memory
+void writeColumn(std::int64_t count) {
+  static std::int64_t written = -1;
+  if (written == count) {
+    return;
+  }
+  strong::ColumnHeader header;
+  header.fingerprint = strong::configFingerprint<StoredIdConfig>();
+  header.elementSize = sizeof(StoredId);
+  header.count = static_cast<std::uint64_t>(count);
+  std::ofstream file{columnPath(), std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  std::vector<StoredId> chunk;
+  for (std::int64_t first = 0; first < count; first += 1 << 20) {
+    chunk.clear();
+    for (auto id = first; id < std::min(count, first + (1 << 20)); ++id) {
+      chunk.emplace_back(id);
+    }
+    file.write(reinterpret_cast<const char*>(chunk.data()),
+               static_cast<std::streamsize>(chunk.size() * sizeof(StoredId)));
+  }
+  written = count;
+}
+
+// drops the file from the page cache, so the next access reads from disk
+void evictColumn() {
+#if defined(__linux__)
+  const int file = ::open(columnPath().c_str(), O_RDONLY);
+  ::fdatasync(file);
+  ::posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+  ::close(file);
+#endif
+}
+
+template <typename range>
+auto sum(const range& ids) -> std::int64_t {
+  std::int64_t total = 0;
+  for (const auto& id : ids) {
+    total += id.get();
+  }
+  return total;
+}
+
+void BM_WriteColumn(benchmark::State& state) {
+  const std::vector<StoredId> ids(static_cast<std::size_t>(state.range(0)));
+  const auto path =
+      std::filesystem::temp_directory_path() / "StrongColumnWrite.col";
+  for (auto _ : state) {
+    strong::write_column<StoredId>(path, ids);
+  }
+  std::filesystem::remove(path);
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(StoredId)));
+}
+
+// the former approach: one read per element into a vector
+void BM_LoadPerElement(benchmark::State& state) {
+  writeColumn(state.range(0));
+  for (auto _ : state) {
+    std::ifstream file{columnPath(), std::ios::binary};
+    file.seekg(sizeof(strong::ColumnHeader));
+    std::vector<StoredId> ids;
+    std::int64_t value;
+    while (file.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+      ids.emplace_back(value);
+    }
+    benchmark::DoNotOptimize(sum(ids));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// opening only, the values are not touched
+void BM_MapColumnOpen(benchmark::State& state) {
+  writeColumn(state.range(0));
+  for (auto _ : state) {
+    const MappedStrongColumn<StoredId> column{columnPath()};
+    benchmark::DoNotOptimize(column.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MapColumnCold(benchmark::State& state) {
+  writeColumn(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    evictColumn();
+    state.ResumeTiming();
+    const MappedStrongColumn<StoredId> column{columnPath()};
+    benchmark::DoNotOptimize(sum(column));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MapColumnWarm(benchmark::State& state) {
+  writeColumn(state.range(0));
+  for (auto _ : state) {
+    const MappedStrongColumn<StoredId> column{columnPath()};
+    benchmark::DoNotOptimize(sum(column));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_WriteColumn)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_LoadPerElement)
+    ->Arg(columnSize())
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapColumnOpen)->Arg(columnSize());
+BENCHMARK(BM_MapColumnCold)
+    ->Arg(columnSize())
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_MapColumnWarm)
+    ->Arg(columnSize())
+    ->Unit(benchmark::kMillisecond);
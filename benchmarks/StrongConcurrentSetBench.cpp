@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongAtomic.h>
+#include <StrongTypes/StrongConcurrentSet.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace {
+struct DbIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using DbId = StrongType<DbIdConfig>;
+
+constexpr int maxThreads = 8;
+// a stream of ids with repeats, half of the inserts are duplicates once
+// keyRange ids have been seen
+constexpr std::uint64_t keyRange = 1 << 20;
+
+auto streamKey(std::uint64_t i) -> DbId {
+  return DbId{static_cast<std::int64_t>(strong::mixHash(i) % keyRange)};
+}
+
+// the former approach: a mutex per shard of std::unordered_sets
+class ShardedMutexSet {
+ public:
+  auto insert(const DbId& key) -> bool {
+    auto& shard = shards[std::hash<DbId>{}(key) % shards.size()];
+    const std::scoped_lock lock{shard.mutex};
+    return shard.keys.insert(key).second;
+  }
+
+ private:
+  struct alignas(strong::cacheLineSize) Shard {
+    std::mutex mutex;
+    std::unordered_set<DbId> keys;
+  };
+  std::array<Shard, 64> shards;
+};
+
+std::unique_ptr<ShardedMutexSet> mutexSet;
+std::unique_ptr<StrongConcurrentSet<DbId>> concurrentSet;
+
+template <typename Set, typename Create>
+void runInserts(benchmark::State& state, std::unique_ptr<Set>& set,
+                Create create) {
+  if (state.thread_index() == 0) {
+    set = create();
+  }
+  auto i = static_cast<std::uint64_t>(state.thread_index());
+  std::int64_t inserted = 0;
+  for (auto _ : state) {
+    inserted += set->insert(streamKey(i)) ? 1 : 0;
+    i += static_cast<std::uint64_t>(state.threads());
+  }
+  benchmark::DoNotOptimize(inserted);
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    set.reset();
+  }
+}
+
+void BM_ShardedMutexSetInsert(benchmark::State& state) {
+  runInserts(state, mutexSet,
+             [] { return std::make_unique<ShardedMutexSet>(); });
+}
+
+void BM_ConcurrentSetInsert(benchmark::State& state) {
+  runInserts(state, concurrentSet, [] {
+    return std::make_unique<StrongConcurrentSet<DbId>>(keyRange);
+  });
+}
+
+// starting small, the set grows by chaining tables while inserting
+void BM_ConcurrentSetInsertGrowing(benchmark::State& state) {
+  runInserts(state, concurrentSet, [] {
+    return std::make_unique<StrongConcurrentSet<DbId>>(1024);
+  });
+}
+}  // namespace
+
+BENCHMARK(BM_ShardedMutexSetInsert)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_ConcurrentSetInsert)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(BM_ConcurrentSetInsertGrowing)
+    ->ThreadRange(1, maxThreads)
+    ->UseRealTime();
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongFilter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+struct IndexIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using IndexId = StrongType<IndexIdConfig>;
+
+// larger than the caches, like the ids of an on-disk index
+constexpr std::size_t filterKeys = 1000000;
+constexpr std::size_t lookupCount = 1 << 14;
+
+auto idOf(std::uint64_t i) -> IndexId {
+  return IndexId{static_cast<std::int64_t>(strong::mixHash(i))};
+}
+
+// half of the lookups are absent ids
+auto makeLookups() -> std::vector<IndexId> {
+  std::vector<IndexId> ids;
+  for (std::uint64_t i = 0; i < lookupCount; ++i) {
+    const auto key = strong::mixHash(i + 7) % filterKeys;
+    ids.push_back(idOf(i % 2 == 0 ? key : key + filterKeys));
+  }
+  return ids;
+}
+
+template <typename Filter>
+void fill(Filter& filter) {
+  for (std::uint64_t i = 0; i < filterKeys; ++i) {
+    static_cast<void>(filter.insert(idOf(i)));
+  }
+}
+
+template <typename Filter>
+void setCounters(benchmark::State& state, const Filter& filter) {
+  state.SetItemsProcessed(state.iterations() * lookupCount);
+  state.counters["bits_per_key"] =
+      static_cast<double>(filter.bitCount()) / filterKeys;
+  // share of the absent ids reported as contained
+  std::size_t falsePositives = 0;
+  for (std::uint64_t i = 0; i < lookupCount; ++i) {
+    falsePositives += filter.contains(idOf(i + filterKeys)) ? 1 : 0;
+  }
+  state.counters["false_positives"] =
+      static_cast<double>(falsePositives) / lookupCount;
+}
+
+template <typename Filter>
+void runSingle(benchmark::State& state, const Filter& filter) {
+  const auto lookups = makeLookups();
+  for (auto _ : state) {
+    std::size_t contained = 0;
+    for (const auto& id : lookups) {
+      contained += filter.contains(id) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(contained);
+  }
+  setCounters(state, filter);
+}
+
+template <typename Filter>
+void runBatch(benchmark::State& state, const Filter& filter) {
+  const auto lookups = makeLookups();
+  std::vector<std::uint64_t> mask(lookupCount / 64);
+  for (auto _ : state) {
+    filter.contains(std::span<const IndexId>{lookups}, mask);
+    benchmark::DoNotOptimize(mask.data());
+  }
+  setCounters(state, filter);
+}
+
+// the false positive target is 1 / state.range(0)
+auto makeBloom(const benchmark::State& state) -> StrongBloomFilter<IndexId> {
+  StrongBloomFilter<IndexId> filter{filterKeys,
+                                    1.0 / static_cast<double>(state.range(0))};
+  fill(filter);
+  return filter;
+}
+
+void BM_UnorderedSetContains(benchmark::State& state) {
+  std::unordered_set<IndexId> set;
+  for (std::uint64_t i = 0; i < filterKeys; ++i) {
+    set.insert(idOf(i));
+  }
+  const auto lookups = makeLookups();
+  for (auto _ : state) {
+    std::size_t contained = 0;
+    for (const auto& id : lookups) {
+      contained += set.contains(id) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(contained);
+  }
+  state.SetItemsProcessed(state.iterations() * lookupCount);
+}
+void BM_BloomContains(benchmark::State& state) {
+  runSingle(state, makeBloom(state));
+}
+void BM_BloomContainsBatch(benchmark::State& state) {
+  runBatch(state, makeBloom(state));
+}
+template <std::size_t FingerprintBits>
+void BM_CuckooContains(benchmark::State& state) {
+  StrongCuckooFilter<IndexId, FingerprintBits> filter{filterKeys};
+  fill(filter);
+  runSingle(state, filter);
+}
+template <std::size_t FingerprintBits>
+void BM_CuckooContainsBatch(benchmark::State& state) {
+  StrongCuckooFilter<IndexId, FingerprintBits> filter{filterKeys};
+  fill(filter);
+  runBatch(state, filter);
+}
+}  // namespace
+
+BENCHMARK(BM_UnorderedSetContains);
+BENCHMARK(BM_BloomContains)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_BloomContainsBatch)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_CuckooContains<8>);
+BENCHMARK(BM_CuckooContains<16>);
+BENCHMARK(BM_CuckooContains<32>);
+BENCHMARK(BM_CuckooContainsBatch<8>);
+BENCHMARK(BM_CuckooContainsBatch<16>);
+BENCHMARK(BM_CuckooContainsBatch<32>);
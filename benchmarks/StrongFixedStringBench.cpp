@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongFixedString.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+struct StringSymbolConfig {
+  using underlyingType = std::string;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using StringSymbol = StrongType<StringSymbolConfig>;
+using FixedSymbol = StrongFixedString<24>;
+
+// 17 to 24 characters, beyond the small string buffer of std::string
+auto symbolTexts() -> std::vector<std::string> {
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<int> letter{'A', 'Z'};
+  std::uniform_int_distribution<std::size_t> length{17, 24};
+  std::vector<std::string> texts(4096);
+  for (auto& text : texts) {
+    text.resize(length(gen));
+    std::generate(text.begin(), text.end(), [&] {
+      return static_cast<char>(letter(gen));
+    });
+  }
+  return texts;
+}
+
+template <typename Symbol>
+auto makeSymbols() -> std::vector<Symbol> {
+  std::vector<Symbol> symbols;
+  for (const auto& text : symbolTexts()) {
+    if constexpr (std::is_same_v<Symbol, FixedSymbol>) {
+      symbols.emplace_back(strong::FixedString<24>{text});
+    } else {
+      symbols.emplace_back(text);
+    }
+  }
+  return symbols;
+}
+
+template <typename Symbol>
+void BM_Copy(benchmark::State& state) {
+  const auto symbols = makeSymbols<Symbol>();
+  for (auto _ : state) {
+    auto copy = symbols;
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * symbols.size());
+}
+
+template <typename Symbol>
+void BM_Equal(benchmark::State& state) {
+  const auto symbols = makeSymbols<Symbol>();
+  auto shuffled = symbols;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{7});
+  for (auto _ : state) {
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+      equal += symbols[i] == shuffled[i] ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * symbols.size());
+}
+
+template <typename Symbol>
+void BM_Sort(benchmark::State& state) {
+  const auto symbols = makeSymbols<Symbol>();
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = symbols;
+    state.ResumeTiming();
+    std::sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * symbols.size());
+}
+
+template <typename Symbol>
+void BM_Hash(benchmark::State& state) {
+  const auto symbols = makeSymbols<Symbol>();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& symbol : symbols) {
+      sum += std::hash<Symbol>{}(symbol);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * symbols.size());
+}
+}  // namespace
+
+BENCHMARK(BM_Copy<StringSymbol>);
+BENCHMARK(BM_Copy<FixedSymbol>);
+BENCHMARK(BM_Equal<StringSymbol>);
+BENCHMARK(BM_Equal<FixedSymbol>);
+BENCHMARK(BM_Sort<StringSymbol>);
+BENCHMARK(BM_Sort<FixedSymbol>);
+BENCHMARK(BM_Hash<StringSymbol>);
+BENCHMARK(BM_Hash<FixedSymbol>);
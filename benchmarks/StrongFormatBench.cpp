@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongFormat.h>
+
+#include <charconv>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+struct DbIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using DbId = StrongType<DbIdConfig>;
+
+// one id per line, up to 12 digits like auto increment keys
+auto idColumn(std::size_t count) -> std::string {
+  std::mt19937_64 gen{42};
+  std::uniform_int_distribution<std::int64_t> value{0, 999999999999};
+  std::string text;
+  for (std::size_t i = 0; i < count; ++i) {
+    text += std::to_string(value(gen));
+    text += '\n';
+  }
+  return text;
+}
+
+// the former approach: split the lines and std::stol every one
+void BM_ParseStol(benchmark::State& state) {
+  const auto text = idColumn(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<DbId> ids;
+    std::size_t first = 0;
+    while (first < text.size()) {
+      const auto last = text.find('\n', first);
+      ids.emplace_back(std::stol(text.substr(first, last - first)));
+      first = last + 1;
+    }
+    benchmark::DoNotOptimize(ids.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+void BM_ParseFromChars(benchmark::State& state) {
+  const auto text = idColumn(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<DbId> ids;
+    const char* first = text.data();
+    const char* const end = first + text.size();
+    while (first != end) {
+      DbId id;
+      first = strong::from_chars(first, end, id).ptr + 1;
+      ids.push_back(id);
+    }
+    benchmark::DoNotOptimize(ids.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+void BM_ParseColumn(benchmark::State& state) {
+  const auto text = idColumn(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::parse_column<DbId>(text, '\n').data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+// the former approach for logging: get() into an ostream
+void BM_FormatOstream(benchmark::State& state) {
+  const DbId id{123456789012};
+  for (auto _ : state) {
+    std::ostringstream stream;
+    stream << id.get();
+    benchmark::DoNotOptimize(stream.str());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FormatToChars(benchmark::State& state) {
+  const DbId id{123456789012};
+  char text[24];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(id);
+    benchmark::DoNotOptimize(strong::to_chars(text, text + sizeof(text), id));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_ParseStol)->Arg(100000);
+BENCHMARK(BM_ParseFromChars)->Arg(100000);
+BENCHMARK(BM_ParseColumn)->Arg(100000);
+BENCHMARK(BM_FormatOstream);
+BENCHMARK(BM_FormatToChars);
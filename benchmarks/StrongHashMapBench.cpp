@@ -0,0 +1,159 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongHashMap.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+struct BenchIdConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using BenchId = StrongType<BenchIdConfig>;
+
+auto shuffledKeys(std::size_t count, std::uint64_t seed = 42)
+    -> std::vector<long> {
+  std::vector<long> keys(count);
+  std::iota(keys.begin(), keys.end(), 0L);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64{seed});
+  return keys;
+}
+
+void BM_StrongHashMap_Insert(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    StrongHashMap<BenchId, long> map;
+    for (auto key : keys) {
+      map.try_emplace(BenchId{key}, key);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_UnorderedMap_Insert(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::unordered_map<long, long> map;
+    for (auto key : keys) {
+      map.try_emplace(key, key);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StrongHashMap_Lookup(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  StrongHashMap<BenchId, long> map;
+  map.reserve(keys.size());
+  for (auto key : keys) {
+    map.try_emplace(BenchId{key}, key);
+  }
+  // Different order than the insertion, node based maps would otherwise
+  // profit from walking their nodes in allocation order
+  const auto lookups = shuffledKeys(keys.size(), 7);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto key : lookups) {
+      sum += map.find(BenchId{key})->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_UnorderedMap_Lookup(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  std::unordered_map<long, long> map;
+  map.reserve(keys.size());
+  for (auto key : keys) {
+    map.try_emplace(key, key);
+  }
+  // Different order than the insertion, node based maps would otherwise
+  // profit from walking their nodes in allocation order
+  const auto lookups = shuffledKeys(keys.size(), 7);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto key : lookups) {
+      sum += map.find(key)->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StrongHashMap_LookupMiss(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  StrongHashMap<BenchId, long> map;
+  map.reserve(keys.size());
+  for (auto key : keys) {
+    map.try_emplace(BenchId{key}, key);
+  }
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (auto key : keys) {
+      found += map.contains(BenchId{key + state.range(0)});
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_UnorderedMap_LookupMiss(benchmark::State& state) {
+  const auto keys = shuffledKeys(static_cast<std::size_t>(state.range(0)));
+  std::unordered_map<long, long> map;
+  map.reserve(keys.size());
+  for (auto key : keys) {
+    map.try_emplace(key, key);
+  }
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (auto key : keys) {
+      found += map.contains(key + state.range(0));
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_StrongHashMap_Insert)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UnorderedMap_Insert)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StrongHashMap_Lookup)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UnorderedMap_Lookup)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StrongHashMap_LookupMiss)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UnorderedMap_LookupMiss)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongIdGenerator.h>
+
+#include <atomic>
+
+namespace {
+struct RowIdConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using RowId = StrongType<RowIdConfig>;
+
+std::atomic<long> sharedCounter{1};
+
+// what the generator replaces: every id is a fetch_add on one cache line
+void BM_AtomicFetchAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        RowId{sharedCounter.fetch_add(1, std::memory_order_relaxed)});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_StrongIdGenerator(benchmark::State& state) {
+  auto& generator = StrongIdGenerator<RowId>::global();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(generator.next());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_AtomicFetchAdd)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(BM_StrongIdGenerator)->ThreadRange(1, 128)->UseRealTime();
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongInternedString.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+// the examples' guid2 approach: a StrongType over std::string
+struct GuidStringConfig {
+  using underlyingType = std::string;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using GuidString = StrongType<GuidStringConfig>;
+
+struct GuidInternedConfig {
+  using underlyingType = strong::InternedString;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using GuidInterned = StrongType<GuidInternedConfig>;
+
+// a small set of distinct guids which repeats, like tenant ids in requests
+constexpr std::size_t distinct = 1000;
+
+auto guidTexts(std::size_t count) -> std::vector<std::string> {
+  std::mt19937_64 random{42};
+  std::vector<std::string> texts;
+  texts.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto index = random() % distinct;
+    char text[39];
+    std::snprintf(text, sizeof(text), "{%08zx-0000-4000-8000-%012zx}", index,
+                  index * 7919);
+    texts.emplace_back(text);
+  }
+  return texts;
+}
+
+template <typename T>
+auto makeGuids(std::size_t count, strong::InternTable* table = nullptr)
+    -> std::vector<T> {
+  std::vector<T> guids;
+  guids.reserve(count);
+  for (auto& text : guidTexts(count)) {
+    if constexpr (std::is_same_v<T, GuidInterned>) {
+      guids.emplace_back(strong::InternedString{*table, text});
+    } else {
+      guids.emplace_back(std::move(text));
+    }
+  }
+  return guids;
+}
+
+constexpr std::size_t elements = 1 << 16;
+
+template <typename T>
+void BM_Equal(benchmark::State& state) {
+  strong::InternTable table;
+  const auto guids = makeGuids<T>(elements, &table);
+  const auto& needle = guids[elements / 2];
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& guid : guids) {
+      count += guid == needle ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_HashSetLookup(benchmark::State& state) {
+  strong::InternTable table;
+  const auto guids = makeGuids<T>(elements, &table);
+  const std::unordered_set<T> known(guids.begin(), guids.end());
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& guid : guids) {
+      count += known.count(guid);
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_Copy(benchmark::State& state) {
+  strong::InternTable table;
+  const auto guids = makeGuids<T>(elements, &table);
+  for (auto _ : state) {
+    auto copy = guids;
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+// heap bytes per value: the strings' buffers or the vector of handles plus
+// the shared arena of the table
+void BM_Memory(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::size_t stringBytes = 0;
+  std::size_t internedBytes = 0;
+  for (auto _ : state) {
+    const auto strings = makeGuids<GuidString>(count);
+    stringBytes = strings.size() * sizeof(GuidString);
+    for (const auto& guid : strings) {
+      stringBytes += guid.get().capacity() + 1;
+    }
+    strong::InternTable table;
+    const auto interned = makeGuids<GuidInterned>(count, &table);
+    internedBytes = interned.size() * sizeof(GuidInterned) + table.arenaBytes();
+  }
+  state.counters["string_bytes_per_value"] =
+      static_cast<double>(stringBytes) / static_cast<double>(count);
+  state.counters["interned_bytes_per_value"] =
+      static_cast<double>(internedBytes) / static_cast<double>(count);
+}
+
+// interning of already known values from many threads, the common case
+void BM_InternConcurrent(benchmark::State& state) {
+  static const auto texts = guidTexts(elements);
+  std::size_t i = static_cast<std::size_t>(state.thread_index()) * 997;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        GuidInterned{strong::InternedString{texts[i++ % elements]}});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_Equal<GuidString>);
+BENCHMARK(BM_Equal<GuidInterned>);
+BENCHMARK(BM_HashSetLookup<GuidString>);
+BENCHMARK(BM_HashSetLookup<GuidInterned>);
+BENCHMARK(BM_Copy<GuidString>);
+BENCHMARK(BM_Copy<GuidInterned>);
+BENCHMARK(BM_Memory)->Arg(1'000'000)->Iterations(1)->Unit(
+    benchmark::kMillisecond);
+BENCHMARK(BM_InternConcurrent)->ThreadRange(1, 64)->UseRealTime();
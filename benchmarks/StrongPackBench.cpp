@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongPack.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+template <typename T>
+struct PackedFieldConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+struct BenchShardConfig : PackedFieldConfig<int> {};
+struct BenchPartitionConfig : PackedFieldConfig<int> {};
+struct BenchFlagsConfig : PackedFieldConfig<std::uint8_t> {};
+struct BenchVersionConfig : PackedFieldConfig<int> {};
+using Shard = StrongType<BenchShardConfig>;
+using Partition = StrongType<BenchPartitionConfig>;
+using Flags = StrongType<BenchFlagsConfig>;
+using Version = StrongType<BenchVersionConfig>;
+
+// the routing key as a struct of StrongTypes, 16 bytes
+struct RouteStruct {
+  Shard shard;
+  Partition partition;
+  Flags flags;
+  Version version;
+
+  auto operator<=>(const RouteStruct&) const = default;
+};
+// the same in 4 bytes
+using RoutePack =
+    StrongPack<strong::Field<Shard, 10>, strong::Field<Partition, 8>,
+               strong::Field<Flags, 4>, strong::Field<Version, 10>>;
+
+template <typename Route>
+auto makeRoutes(std::size_t count) -> std::vector<Route> {
+  std::mt19937 random{42};
+  std::vector<Route> routes;
+  routes.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const Shard shard{static_cast<int>(random() % 512)};
+    const Partition partition{static_cast<int>(random() % 128)};
+    const Flags flags{static_cast<std::uint8_t>(random() % 8)};
+    const Version version{static_cast<int>(random() % 512)};
+    if constexpr (std::is_same_v<Route, RoutePack>) {
+      routes.emplace_back(shard, partition, flags, version);
+    } else {
+      routes.push_back(Route{shard, partition, flags, version});
+    }
+  }
+  return routes;
+}
+
+template <typename Route>
+void BM_Equal(benchmark::State& state) {
+  const auto routes =
+      makeRoutes<Route>(static_cast<std::size_t>(state.range(0)));
+  const auto needle = routes[routes.size() / 2];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(routes.begin(), routes.end(), needle));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_route"] = sizeof(Route);
+}
+
+template <typename Route>
+void BM_Sort(benchmark::State& state) {
+  const auto routes =
+      makeRoutes<Route>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = routes;
+    state.ResumeTiming();
+    std::sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_GetField(benchmark::State& state) {
+  const auto routes =
+      makeRoutes<RoutePack>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& route : routes) {
+      sum += route.get<Version>().get();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_AtomicSetField(benchmark::State& state) {
+  static StrongAtomicPack<RoutePack> shared;
+  int i = 0;
+  for (auto _ : state) {
+    shared.set(Version{i++ & 511});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+// 1M routes: 16 MB as structs, 4 MB packed
+BENCHMARK(BM_Equal<RouteStruct>)->Arg(1 << 20);
+BENCHMARK(BM_Equal<RoutePack>)->Arg(1 << 20);
+BENCHMARK(BM_Sort<RouteStruct>)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Sort<RoutePack>)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetField)->Arg(1 << 20);
+BENCHMARK(BM_AtomicSetField)->ThreadRange(1, 8)->UseRealTime();
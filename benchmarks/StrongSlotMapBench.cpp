@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongSlotMap.h>
+
+#include <cstdint>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+struct OrderTag {};
+using OrderHandle = StrongHandle<OrderTag>;
+
+// a 32 byte payload like a small order record
+struct Order {
+  std::int64_t price;
+  std::int64_t qty;
+  std::int64_t timestamp;
+  std::int64_t account;
+};
+
+// the current approach: ids from a counter into an unordered_map
+struct UnorderedTable {
+  std::unordered_map<std::int64_t, Order> orders;
+  std::int64_t next = 0;
+
+  auto insert(const Order& order) -> std::int64_t {
+    orders.emplace(next, order);
+    return next++;
+  }
+  auto erase(std::int64_t id) -> bool { return orders.erase(id) != 0; }
+  auto find(std::int64_t id) -> Order* {
+    const auto it = orders.find(id);
+    return it == orders.end() ? nullptr : &it->second;
+  }
+};
+struct SlotTable {
+  StrongSlotMap<OrderHandle, Order> orders;
+
+  auto insert(const Order& order) -> OrderHandle {
+    return orders.insert(order);
+  }
+  auto erase(OrderHandle handle) -> bool { return orders.erase(handle); }
+  auto find(OrderHandle handle) -> Order* { return orders.find(handle); }
+};
+
+template <typename Table>
+void BM_Insert(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    Table table;
+    for (std::size_t i = 0; i < count; ++i) {
+      benchmark::DoNotOptimize(table.insert(Order{}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Table>
+void BM_Lookup(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  Table table;
+  std::vector<decltype(table.insert(Order{}))> handles;
+  for (std::size_t i = 0; i < count; ++i) {
+    handles.push_back(table.insert(Order{}));
+  }
+  std::shuffle(handles.begin(), handles.end(), std::mt19937{42});
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& handle : handles) {
+      sum += table.find(handle)->qty;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// a steady state of live orders with one erase and one insert per step, plus
+// lookups of live and already erased ids
+template <typename Table>
+void BM_Churn(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  Table table;
+  std::vector<decltype(table.insert(Order{}))> handles;
+  for (std::size_t i = 0; i < count; ++i) {
+    handles.push_back(table.insert(Order{}));
+  }
+  std::mt19937_64 random{42};
+  for (auto _ : state) {
+    const auto at = random() % count;
+    const auto erased = handles[at];
+    benchmark::DoNotOptimize(table.erase(erased));
+    handles[at] = table.insert(Order{});
+    benchmark::DoNotOptimize(table.find(handles[random() % count]));
+    benchmark::DoNotOptimize(table.find(erased));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Iterate(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  SlotTable table;
+  for (std::size_t i = 0; i < count; ++i) {
+    table.insert(Order{});
+  }
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& order : table.orders) {
+      sum += order.qty;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_Insert<UnorderedTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Insert<SlotTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Lookup<UnorderedTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Lookup<SlotTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Churn<UnorderedTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Churn<SlotTable>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Iterate)->Range(1 << 10, 1 << 20);
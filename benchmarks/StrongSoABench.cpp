@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongSoA.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+template <typename T>
+struct ColumnConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+struct SoAIdConfig : ColumnConfig<std::int64_t> {};
+struct SoAPriceConfig : ColumnConfig<double> {};
+struct SoAQtyConfig : ColumnConfig<std::int64_t> {};
+struct SoATimestampConfig : ColumnConfig<std::int64_t> {};
+using Id = StrongType<SoAIdConfig>;
+using Price = StrongType<SoAPriceConfig>;
+using Qty = StrongType<SoAQtyConfig>;
+using Timestamp = StrongType<SoATimestampConfig>;
+
+// the record as it is stored in a std::vector today, 32 bytes
+struct Record {
+  Id id;
+  Price price;
+  Qty qty;
+  Timestamp timestamp;
+};
+using Records = StrongSoA<Id, Price, Qty, Timestamp>;
+
+auto makeAoS(std::size_t count) -> std::vector<Record> {
+  std::mt19937_64 random{42};
+  std::uniform_real_distribution<double> price{1.0, 100.0};
+  std::vector<Record> records;
+  records.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    records.push_back({Id{static_cast<std::int64_t>(random() % count)},
+                       Price{price(random)},
+                       Qty{static_cast<std::int64_t>(random() % 1000)},
+                       Timestamp{static_cast<std::int64_t>(i)}});
+  }
+  return records;
+}
+
+auto makeSoA(std::size_t count) -> Records {
+  Records records;
+  records.reserve(count);
+  for (const auto& record : makeAoS(count)) {
+    records.push_back(record.id, record.price, record.qty, record.timestamp);
+  }
+  return records;
+}
+
+void BM_AoS_ScanColumn(benchmark::State& state) {
+  const auto records = makeAoS(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& record : records) {
+      sum += record.qty.get();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SoA_ScanColumn(benchmark::State& state) {
+  const auto records = makeSoA(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& qty : records.column<Qty>()) {
+      sum += qty.get();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// sum of the quantity of every record above a price, touches two fields
+void BM_AoS_Filter(benchmark::State& state) {
+  const auto records = makeAoS(static_cast<std::size_t>(state.range(0)));
+  const Price limit{90.0};
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& record : records) {
+      sum += record.price > limit ? record.qty.get() : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SoA_Filter(benchmark::State& state) {
+  const auto records = makeSoA(static_cast<std::size_t>(state.range(0)));
+  const Price limit{90.0};
+  for (auto _ : state) {
+    const auto prices = records.column<Price>();
+    const auto quantities = records.column<Qty>();
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+      sum += prices[i] > limit ? quantities[i].get() : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_AoS_SortBy(benchmark::State& state) {
+  const auto records = makeAoS(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = records;
+    state.ResumeTiming();
+    std::stable_sort(copy.begin(), copy.end(),
+                     [](const Record& lhs, const Record& rhs) {
+                       return lhs.id < rhs.id;
+                     });
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SoA_SortBy(benchmark::State& state) {
+  const auto records = makeSoA(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = records;
+    state.ResumeTiming();
+    copy.sort_by<Id>();
+    benchmark::DoNotOptimize(copy.column<Id>().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+// 64K rows stay in L2, 4M rows (128 MB as AoS) are bound by memory bandwidth
+BENCHMARK(BM_AoS_ScanColumn)->Range(1 << 16, 1 << 22);
+BENCHMARK(BM_SoA_ScanColumn)->Range(1 << 16, 1 << 22);
+BENCHMARK(BM_AoS_Filter)->Range(1 << 16, 1 << 22);
+BENCHMARK(BM_SoA_Filter)->Range(1 << 16, 1 << 22);
+BENCHMARK(BM_AoS_SortBy)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SoA_SortBy)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongSort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+struct DbIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using DbId = StrongType<DbIdConfig>;
+
+// ids of a table with a few billion rows, so the top bytes are mostly zero
+auto makeIds(std::size_t count) -> std::vector<DbId> {
+  std::mt19937_64 random{42};
+  std::vector<DbId> ids;
+  ids.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    ids.emplace_back(static_cast<std::int64_t>(random() % 4'000'000'000));
+  }
+  return ids;
+}
+
+template <typename sorter>
+void runSort(benchmark::State& state, sorter sort) {
+  const auto source = makeIds(static_cast<std::size_t>(state.range(0)));
+  std::vector<DbId> ids(source.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(source.begin(), source.end(), ids.begin());
+    state.ResumeTiming();
+    sort(ids);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StdSort(benchmark::State& state) {
+  runSort(state, [](std::vector<DbId>& ids) {
+    std::sort(ids.begin(), ids.end());
+  });
+}
+
+void BM_StrongSort(benchmark::State& state) {
+  runSort(state, [](std::vector<DbId>& ids) { strong::sort(ids); });
+}
+
+void BM_StrongSortParallel(benchmark::State& state) {
+  runSort(state,
+          [](std::vector<DbId>& ids) { strong::sort(strong::par, ids); });
+}
+}  // namespace
+
+// 1B elements need about 24 GB (source, values and the radix scratch buffer)
+#define STRONG_SORT_BENCHMARK(name)                               \
+  BENCHMARK(name)                                                 \
+      ->Arg(10'000'000)                                           \
+      ->Arg(100'000'000)                                          \
+      ->Arg(1'000'000'000)                                        \
+      ->Unit(benchmark::kMillisecond)                             \
+      ->UseRealTime()
+
+STRONG_SORT_BENCHMARK(BM_StdSort);
+STRONG_SORT_BENCHMARK(BM_StrongSort);
+STRONG_SORT_BENCHMARK(BM_StrongSortParallel);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongStaticMap.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+struct SortedCodeConfig {
+  using underlyingType = std::uint32_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using SortedCode = StrongType<SortedCodeConfig>;
+
+struct HashedCodeConfig : SortedCodeConfig {
+  static constexpr bool spaceship = false;
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+};
+using HashedCode = StrongType<HashedCodeConfig>;
+
+// sparse codes like error codes or exchange ids
+constexpr auto codeOf(std::size_t i) -> std::uint32_t {
+  return static_cast<std::uint32_t>(i * i * 7 + 13);
+}
+
+template <typename Key, std::size_t N>
+constexpr auto makeEntries() {
+  return []<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array{std::pair{Key{codeOf(I)}, std::uint32_t{I}}...};
+  }(std::make_index_sequence<N>{});
+}
+
+// half of the lookups miss
+template <typename Key, std::size_t N>
+auto makeLookups() -> std::vector<Key> {
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<std::size_t> index{0, N - 1};
+  std::vector<Key> keys(4096);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = Key{codeOf(index(gen)) + static_cast<std::uint32_t>(i % 2)};
+  }
+  return keys;
+}
+
+template <typename Key, std::size_t N, typename Find>
+void runLookups(benchmark::State& state, Find find) {
+  const auto lookups = makeLookups<Key, N>();
+  for (auto _ : state) {
+    std::uint32_t sum = 0;
+    for (const auto& key : lookups) {
+      sum += find(key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+
+template <std::size_t N>
+void BM_StdMap(benchmark::State& state) {
+  const auto entries = makeEntries<SortedCode, N>();
+  const std::map<SortedCode, std::uint32_t> map(entries.begin(),
+                                                entries.end());
+  runLookups<SortedCode, N>(state, [&](const SortedCode& key) {
+    const auto found = map.find(key);
+    return found == map.end() ? 0 : found->second;
+  });
+}
+template <std::size_t N>
+void BM_StdUnorderedMap(benchmark::State& state) {
+  const auto entries = makeEntries<HashedCode, N>();
+  const std::unordered_map<HashedCode, std::uint32_t> map(entries.begin(),
+                                                          entries.end());
+  runLookups<HashedCode, N>(state, [&](const HashedCode& key) {
+    const auto found = map.find(key);
+    return found == map.end() ? 0 : found->second;
+  });
+}
+template <std::size_t N>
+void BM_StaticMapEytzinger(benchmark::State& state) {
+  static constexpr strong::static_map<SortedCode, std::uint32_t, N> map{
+      makeEntries<SortedCode, N>()};
+  runLookups<SortedCode, N>(state, [&](const SortedCode& key) {
+    const auto* found = map.find(key);
+    return found == nullptr ? 0 : *found;
+  });
+}
+template <std::size_t N>
+void BM_StaticMapPerfectHash(benchmark::State& state) {
+  static constexpr strong::static_map<HashedCode, std::uint32_t, N> map{
+      makeEntries<HashedCode, N>()};
+  runLookups<HashedCode, N>(state, [&](const HashedCode& key) {
+    const auto* found = map.find(key);
+    return found == nullptr ? 0 : *found;
+  });
+}
+}  // namespace
+
+BENCHMARK(BM_StdMap<16>);
+BENCHMARK(BM_StdUnorderedMap<16>);
+BENCHMARK(BM_StaticMapEytzinger<16>);
+BENCHMARK(BM_StaticMapPerfectHash<16>);
+BENCHMARK(BM_StdMap<256>);
+BENCHMARK(BM_StdUnorderedMap<256>);
+BENCHMARK(BM_StaticMapEytzinger<256>);
+BENCHMARK(BM_StaticMapPerfectHash<256>);
@@ -0,0 +1,334 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_MSC_VER)
+#define STRONGTYPES_BENCH_NOINLINE __declspec(noinline)
+#else
+#define STRONGTYPES_BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+// a 32 byte record, too large to be passed in registers
+struct Record {
+  std::int64_t id;
+  std::int64_t price;
+  std::int64_t qty;
+  std::int64_t timestamp;
+
+  auto operator<=>(const Record&) const = default;
+};
+}  // namespace
+
+template <>
+struct std::hash<Record> {
+  auto operator()(const Record& record) const noexcept -> std::size_t {
+    return std::hash<std::int64_t>{}(record.id) ^
+           (std::hash<std::int64_t>{}(record.timestamp) << 1);
+  }
+};
+
+namespace {
+template <typename T>
+struct CoreConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+template <typename T>
+using Core = StrongType<CoreConfig<T>>;
+
+// no extra space in the class layout
+static_assert(sizeof(Core<int>) == sizeof(int));
+static_assert(sizeof(Core<long>) == sizeof(long));
+static_assert(sizeof(Core<double>) == sizeof(double));
+static_assert(sizeof(Core<std::string>) == sizeof(std::string));
+static_assert(sizeof(Core<Record>) == sizeof(Record));
+static_assert(std::is_trivially_copyable_v<Core<Record>>);
+
+constexpr std::size_t elements = 1 << 12;
+
+template <typename T>
+auto makeValue(std::mt19937_64& random) -> T {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // beyond the small string buffer
+    return "instrument-" + std::to_string(random() % 1'000'000'000);
+  } else if constexpr (std::is_same_v<T, Record>) {
+    const auto id = static_cast<std::int64_t>(random() % 1000);
+    return Record{id, id * 3, id % 7, static_cast<std::int64_t>(random())};
+  } else {
+    return static_cast<T>(random() % 1'000'000);
+  }
+}
+
+template <typename T>
+auto makeValues() -> std::vector<T> {
+  std::mt19937_64 random{42};
+  std::vector<T> values;
+  values.reserve(elements);
+  for (std::size_t i = 0; i < elements; ++i) {
+    values.push_back(makeValue<T>(random));
+  }
+  return values;
+}
+
+// the same values as raw or strong type, V is T or Core<T>
+template <typename V, typename T>
+auto asValues(const std::vector<T>& values) -> std::vector<V> {
+  std::vector<V> result;
+  result.reserve(values.size());
+  for (const auto& value : values) {
+    result.emplace_back(value);
+  }
+  return result;
+}
+
+struct ThreeWay {
+  template <typename V>
+  auto operator()(const V& lhs, const V& rhs) const -> bool {
+    return (lhs <=> rhs) < 0;
+  }
+};
+
+template <typename V, typename T>
+void runConstruct(benchmark::State& state) {
+  const auto source = makeValues<T>();
+  for (auto _ : state) {
+    auto values = asValues<V>(source);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename V, typename T, typename op>
+void runCompare(benchmark::State& state) {
+  const auto lhs = asValues<V>(makeValues<T>());
+  auto rhs = lhs;
+  std::shuffle(rhs.begin(), rhs.end(), std::mt19937_64{7});
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < elements; ++i) {
+      count += op{}(lhs[i], rhs[i]) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename V, typename T>
+void runSort(benchmark::State& state) {
+  const auto source = asValues<V>(makeValues<T>());
+  auto values = source;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(source.begin(), source.end(), values.begin());
+    state.ResumeTiming();
+    std::sort(values.begin(), values.end());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename V, typename T>
+void runHash(benchmark::State& state) {
+  const auto values = asValues<V>(makeValues<T>());
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& value : values) {
+      sum += std::hash<V>{}(value);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename V, typename T>
+void runContainer(benchmark::State& state) {
+  const auto values = asValues<V>(makeValues<T>());
+  for (auto _ : state) {
+    std::unordered_set<V> set;
+    for (const auto& value : values) {
+      set.insert(value);
+    }
+    std::size_t found = 0;
+    for (const auto& value : values) {
+      found += set.count(value);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template <typename T>
+void BM_Raw_Construct(benchmark::State& state) {
+  runConstruct<T, T>(state);
+}
+template <typename T>
+void BM_Strong_Construct(benchmark::State& state) {
+  runConstruct<Core<T>, T>(state);
+}
+template <typename T, typename op>
+void BM_Raw_Compare(benchmark::State& state) {
+  runCompare<T, T, op>(state);
+}
+template <typename T, typename op>
+void BM_Strong_Compare(benchmark::State& state) {
+  runCompare<Core<T>, T, op>(state);
+}
+template <typename T>
+void BM_Raw_Sort(benchmark::State& state) {
+  runSort<T, T>(state);
+}
+template <typename T>
+void BM_Strong_Sort(benchmark::State& state) {
+  runSort<Core<T>, T>(state);
+}
+template <typename T>
+void BM_Raw_Hash(benchmark::State& state) {
+  runHash<T, T>(state);
+}
+template <typename T>
+void BM_Strong_Hash(benchmark::State& state) {
+  runHash<Core<T>, T>(state);
+}
+template <typename T>
+void BM_Raw_UnorderedSet(benchmark::State& state) {
+  runContainer<T, T>(state);
+}
+template <typename T>
+void BM_Strong_UnorderedSet(benchmark::State& state) {
+  runContainer<Core<T>, T>(state);
+}
+
+// type_cref passes values smaller than a pointer by copy, the others by
+// const reference. Calls which aren't inlined show which is cheaper per type
+template <std::size_t N>
+struct Blob {
+  std::array<std::uint32_t, N / 4> words;
+};
+
+template <typename T>
+auto checksum(const T& value) -> std::uint32_t {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<std::uint32_t>(value);
+  } else {
+    return value.words.front() + value.words.back();
+  }
+}
+template <typename T>
+auto makePassed(std::size_t i) -> T {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<T>(i);
+  } else {
+    T blob;
+    blob.words.fill(static_cast<std::uint32_t>(i));
+    return blob;
+  }
+}
+
+template <typename T>
+STRONGTYPES_BENCH_NOINLINE auto passByValue(T value) -> std::uint32_t {
+  return checksum(value);
+}
+template <typename T>
+STRONGTYPES_BENCH_NOINLINE auto passByRef(const T& value) -> std::uint32_t {
+  return checksum(value);
+}
+template <typename T>
+STRONGTYPES_BENCH_NOINLINE auto passTypeCref(typename Core<T>::type_cref value)
+    -> std::uint32_t {
+  return checksum(value);
+}
+
+template <typename T, auto function>
+void runPass(benchmark::State& state) {
+  std::vector<T> values;
+  for (std::size_t i = 0; i < elements; ++i) {
+    values.push_back(makePassed<T>(i));
+  }
+  for (auto _ : state) {
+    std::uint32_t sum = 0;
+    for (const auto& value : values) {
+      sum += function(value);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * elements);
+}
+template <typename T>
+void BM_PassByValue(benchmark::State& state) {
+  runPass<T, passByValue<T>>(state);
+}
+template <typename T>
+void BM_PassByRef(benchmark::State& state) {
+  runPass<T, passByRef<T>>(state);
+}
+template <typename T>
+void BM_PassTypeCref(benchmark::State& state) {
+  runPass<T, passTypeCref<T>>(state);
+}
+}  // namespace
+
+#define STRONG_CORE_BENCHMARK(type)                                 \
+  BENCHMARK(BM_Raw_Construct<type>);                                \
+  BENCHMARK(BM_Strong_Construct<type>);                             \
+  BENCHMARK(BM_Raw_Compare<type, std::equal_to<>>);                 \
+  BENCHMARK(BM_Strong_Compare<type, std::equal_to<>>);              \
+  BENCHMARK(BM_Raw_Compare<type, std::not_equal_to<>>);             \
+  BENCHMARK(BM_Strong_Compare<type, std::not_equal_to<>>);          \
+  BENCHMARK(BM_Raw_Compare<type, std::less<>>);                     \
+  BENCHMARK(BM_Strong_Compare<type, std::less<>>);                  \
+  BENCHMARK(BM_Raw_Compare<type, std::less_equal<>>);               \
+  BENCHMARK(BM_Strong_Compare<type, std::less_equal<>>);            \
+  BENCHMARK(BM_Raw_Compare<type, std::greater<>>);                  \
+  BENCHMARK(BM_Strong_Compare<type, std::greater<>>);               \
+  BENCHMARK(BM_Raw_Compare<type, std::greater_equal<>>);            \
+  BENCHMARK(BM_Strong_Compare<type, std::greater_equal<>>);         \
+  BENCHMARK(BM_Raw_Compare<type, ThreeWay>);                        \
+  BENCHMARK(BM_Strong_Compare<type, ThreeWay>);                     \
+  BENCHMARK(BM_Raw_Sort<type>);                                     \
+  BENCHMARK(BM_Strong_Sort<type>);                                  \
+  BENCHMARK(BM_Raw_Hash<type>);                                     \
+  BENCHMARK(BM_Strong_Hash<type>);                                  \
+  BENCHMARK(BM_Raw_UnorderedSet<type>);                             \
+  BENCHMARK(BM_Strong_UnorderedSet<type>)
+
+STRONG_CORE_BENCHMARK(int);
+STRONG_CORE_BENCHMARK(long);
+STRONG_CORE_BENCHMARK(double);
+STRONG_CORE_BENCHMARK(std::string);
+STRONG_CORE_BENCHMARK(Record);
+
+#define STRONG_PASS_BENCHMARK(type)  \
+  BENCHMARK(BM_PassByValue<type>);   \
+  BENCHMARK(BM_PassByRef<type>);     \
+  BENCHMARK(BM_PassTypeCref<type>)
+
+STRONG_PASS_BENCHMARK(int);
+STRONG_PASS_BENCHMARK(std::int64_t);
+STRONG_PASS_BENCHMARK(double);
+STRONG_PASS_BENCHMARK(Blob<4>);
+STRONG_PASS_BENCHMARK(Blob<8>);
+STRONG_PASS_BENCHMARK(Blob<16>);
+STRONG_PASS_BENCHMARK(Blob<24>);
+STRONG_PASS_BENCHMARK(Blob<32>);
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongUnits.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ratio>
+#include <span>
+#include <vector>
+
+namespace {
+struct BenchDuration {};
+
+struct BenchMillisecondsConfig {
+  using underlyingType = std::int64_t;
+  using unit = strong::Unit<BenchDuration, std::milli>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using BenchMilliseconds = StrongType<BenchMillisecondsConfig>;
+
+struct BenchMicrosecondsConfig : BenchMillisecondsConfig {
+  using unit = strong::Unit<BenchDuration, std::micro>;
+};
+using BenchMicroseconds = StrongType<BenchMicrosecondsConfig>;
+
+struct BenchFloatSecondsConfig : BenchMillisecondsConfig {
+  using underlyingType = double;
+  using unit = strong::Unit<BenchDuration>;
+};
+using BenchFloatSeconds = StrongType<BenchFloatSecondsConfig>;
+
+// a timestamp column larger than the caches
+constexpr std::size_t columnSize = 1 << 24;
+
+template <typename T>
+auto makeColumn() -> std::vector<T> {
+  std::vector<T> column;
+  column.reserve(columnSize);
+  for (std::size_t i = 0; i < columnSize; ++i) {
+    column.emplace_back(1'700'000'000'000 + static_cast<std::int64_t>(i) * 37);
+  }
+  return column;
+}
+
+template <typename From, typename To>
+void setCounters(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * columnSize);
+  state.SetBytesProcessed(state.iterations() * columnSize *
+                          (sizeof(From) + sizeof(To)));
+}
+
+// the former approach: converting by hand through get()
+void BM_ConvertByHand(benchmark::State& state) {
+  const auto millis = makeColumn<BenchMilliseconds>();
+  std::vector<BenchMicroseconds> micros(columnSize);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < columnSize; ++i) {
+      micros[i] = BenchMicroseconds{millis[i].get() * 1000};
+    }
+    benchmark::DoNotOptimize(micros.data());
+  }
+  setCounters<BenchMilliseconds, BenchMicroseconds>(state);
+}
+void BM_StrongCastLoop(benchmark::State& state) {
+  const auto millis = makeColumn<BenchMilliseconds>();
+  std::vector<BenchMicroseconds> micros(columnSize);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < columnSize; ++i) {
+      micros[i] = strong::strong_cast<BenchMicroseconds>(millis[i]);
+    }
+    benchmark::DoNotOptimize(micros.data());
+  }
+  setCounters<BenchMilliseconds, BenchMicroseconds>(state);
+}
+template <typename From, typename To>
+void BM_Convert(benchmark::State& state) {
+  const auto from = makeColumn<From>();
+  std::vector<To> to(columnSize);
+  for (auto _ : state) {
+    strong::convert(std::span<const From>{from}, std::span{to});
+    benchmark::DoNotOptimize(to.data());
+  }
+  setCounters<From, To>(state);
+}
+// memory bandwidth for reference
+void BM_Memcpy(benchmark::State& state) {
+  const auto from = makeColumn<BenchMilliseconds>();
+  std::vector<BenchMilliseconds> to(columnSize);
+  for (auto _ : state) {
+    std::memcpy(to.data(), from.data(), columnSize * sizeof(from[0]));
+    benchmark::DoNotOptimize(to.data());
+  }
+  setCounters<BenchMilliseconds, BenchMilliseconds>(state);
+}
+}  // namespace
+
+BENCHMARK(BM_ConvertByHand);
+BENCHMARK(BM_StrongCastLoop);
+BENCHMARK(BM_Convert<BenchMilliseconds, BenchMicroseconds>);
+BENCHMARK(BM_Convert<BenchMicroseconds, BenchMilliseconds>);
+BENCHMARK(BM_Convert<BenchMilliseconds, BenchFloatSeconds>);
+BENCHMARK(BM_Memcpy);
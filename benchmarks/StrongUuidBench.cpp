@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <StrongTypes/StrongUuid.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace {
+auto uuidTexts() -> std::vector<std::string> {
+  std::vector<std::string> texts;
+  for (int i = 0; i < 1024; ++i) {
+    texts.push_back(strong::toString(strong::generateUuidV4()));
+  }
+  return texts;
+}
+
+// what the former example did in guid2::operator bool on every call
+void BM_RegexValidate(benchmark::State& state) {
+  const auto texts = uuidTexts();
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const std::regex r{
+        "^[{]?[0-9a-fA-F]{8}-([0-9a-fA-F]{4}-){3}[0-9a-fA-F]{12}[}]?$"};
+    benchmark::DoNotOptimize(std::regex_match(texts[i++ % texts.size()], r));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// the same with the regex built once
+void BM_RegexValidatePrebuilt(benchmark::State& state) {
+  const auto texts = uuidTexts();
+  const std::regex r{
+      "^[{]?[0-9a-fA-F]{8}-([0-9a-fA-F]{4}-){3}[0-9a-fA-F]{12}[}]?$"};
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::regex_match(texts[i++ % texts.size()], r));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ParseUuid(benchmark::State& state) {
+  const auto texts = uuidTexts();
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::parseUuid(texts[i++ % texts.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FormatUuid(benchmark::State& state) {
+  const auto uuid = strong::generateUuidV4();
+  char text[strong::uuidTextSize];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(uuid);
+    strong::formatUuid(uuid, text);
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_GenerateUuidV4(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::generateUuidV4());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_GenerateUuidV7(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strong::generateUuidV7());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_RegexValidate);
+BENCHMARK(BM_RegexValidatePrebuilt);
+BENCHMARK(BM_ParseUuid);
+BENCHMARK(BM_FormatUuid);
+BENCHMARK(BM_GenerateUuidV4);
+BENCHMARK(BM_GenerateUuidV7);
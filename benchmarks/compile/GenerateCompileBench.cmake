@@ -0,0 +1,50 @@
+# Generates the translation units of the compile time benchmark: count
+# StrongType configs in one TU and, as a baseline, as many plain structs with
+# a defaulted operator<=>. Both are only parsed and instantiated
+# (-fsyntax-only), so the difference is the frontend cost of StrongTypes.h
+function(strongtypes_generate_compile_bench count directory)
+    set(underlyingTypes int long double unsigned)
+    set(strong "#include <StrongTypes/StrongTypes.h>\n")
+    set(raw "#include <StrongTypes/StrongTypes.h>\n")
+    math(EXPR last "${count} - 1")
+    foreach(i RANGE ${last})
+        math(EXPR typeIndex "${i} % 4")
+        list(GET underlyingTypes ${typeIndex} type)
+        math(EXPR spaceshipIndex "${i} % 2")
+        if(spaceshipIndex)
+            set(spaceship true)
+        else()
+            set(spaceship false)
+        endif()
+        string(APPEND strong
+"struct Config${i} {
+  using underlyingType = ${type};
+  static constexpr bool spaceship = ${spaceship};
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using Type${i} = StrongType<Config${i}>;
+inline auto use${i}(Type${i} a, Type${i} b) -> bool {
+  return a == b || a < b || a.get() > b.get();
+}
+")
+        string(APPEND raw
+"struct Type${i} {
+  ${type} value;
+  constexpr auto get() const -> ${type} { return value; }
+  auto operator<=>(const Type${i}&) const = default;
+};
+inline auto use${i}(Type${i} a, Type${i} b) -> bool {
+  return a == b || a < b || a.get() > b.get();
+}
+")
+    endforeach()
+    file(WRITE "${directory}/StrongTypesCompileBench.cpp" "${strong}")
+    file(WRITE "${directory}/RawTypesCompileBench.cpp" "${raw}")
+endfunction()
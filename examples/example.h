@@ -1,30 +1,18 @@
 #pragma once
-#include <Objbase.h>
-#include <StrongTypes/StrongTypes.h>
-#include <string>
-#include <stdexcept>
-#include <regex>
-
-
-class guid {
- public:
-  guid() noexcept(false);
-  explicit guid(std::string_view guid) noexcept(false);
+#include <StrongTypes/StrongUuid.h>
 
-  [[nodiscard]] auto get() const noexcept -> std::string_view;
-  [[nodiscard]] auto get() noexcept -> std::string&;
-  operator bool() const;
-
- private:
-  std::string data{};
-};
+#include <optional>
+#include <string>
+#include <string_view>
 
-struct Guid2Config {
-  using underlyingType = std::string;
+// A GUID as 16 bytes inline instead of a std::string. The text is validated
+// once while parsing, a guid object is always valid
+struct GuidConfig {
+  using underlyingType = strong::Uuid;
 
   static constexpr bool spaceship = false;
-  static constexpr bool equal = false;
-  static constexpr bool notEqual = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
 
   static constexpr bool lessThen = false;
   static constexpr bool lessEqual = false;
@@ -32,34 +20,11 @@ struct Guid2Config {
   static constexpr bool greaterEqual = false;
 
   static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
 };
 
-class guid2 : public StrongType<Guid2Config> {
- public:
-  guid2() : StrongType{""} {
-    GUID guid;
-    if (CoCreateGuid(&guid) != S_OK) {
-      throw std::logic_error("Can't create GUID!");
-    }
-    wchar_t* guidString = nullptr;
-    if (StringFromCLSID(guid, &guidString) != S_OK) {
-      throw std::logic_error("Can't create String from GUID!");
-    }
+using guid = StrongType<GuidConfig>;
 
-    auto size = WideCharToMultiByte(CP_UTF8, 0, guidString, -1, nullptr, 0,
-                                    nullptr, nullptr);
-    if (size <= 0) {
-      throw std::logic_error("Error converting to UTF-8");
-    }
-    data.resize(size);
-    WideCharToMultiByte(CP_UTF8, 0, guidString, -1, data.data(), data.size(),
-                        nullptr, nullptr);
-    CoTaskMemFree(guidString);
-  }
-  using StrongType::StrongType;
-  operator bool() const {
-    const std::regex r{
-        "^[{]?[0-9a-fA-F]{8}-([0-9a-fA-F]{4}-){3}[0-9a-fA-F]{12}[}]?$"};
-    return std::regex_match(this->data, r);
-  }
-};
\ No newline at end of file
+[[nodiscard]] auto createGuid() -> guid;
+[[nodiscard]] auto parseGuid(std::string_view text) -> std::optional<guid>;
+[[nodiscard]] auto toString(const guid& id) -> std::string;
@@ -0,0 +1,398 @@
+#pragma once
+#include <StrongTypes/StrongSimd.h>
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong {
+namespace detail {
+/**
+ * @brief Concept of a StrongType whose underlying values can be processed by
+ * the SIMD kernels of the current instruction set
+ */
+template <typename T>
+concept isSimdStrongType =
+    isLayoutCompatibleStrongType<T> && hasBatch<typename T::type>;
+
+/**
+ * @brief Concept of the comparison function objects which have SIMD kernels
+ */
+template <typename op>
+concept isSimdComparison =
+    std::is_same_v<op, std::equal_to<>> ||
+    std::is_same_v<op, std::not_equal_to<>> ||
+    std::is_same_v<op, std::less<>> || std::is_same_v<op, std::less_equal<>> ||
+    std::is_same_v<op, std::greater<>> ||
+    std::is_same_v<op, std::greater_equal<>>;
+
+template <typename B>
+inline constexpr std::uint64_t laneMask =
+    B::width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << B::width) - 1;
+
+/**
+ * @brief Bitmask of the lanes for which op(values, pivot) holds
+ */
+template <typename B, typename op>
+[[nodiscard]] inline auto compareBatch(typename B::reg values,
+                                       typename B::reg pivot) noexcept
+    -> std::uint64_t {
+  if constexpr (std::is_same_v<op, std::equal_to<>>) {
+    return B::eq(values, pivot);
+  } else if constexpr (std::is_same_v<op, std::not_equal_to<>>) {
+    return ~B::eq(values, pivot) & laneMask<B>;
+  } else if constexpr (std::is_same_v<op, std::less<>>) {
+    return B::lt(values, pivot);
+  } else if constexpr (std::is_same_v<op, std::less_equal<>>) {
+    return B::lt(values, pivot) | B::eq(values, pivot);
+  } else if constexpr (std::is_same_v<op, std::greater<>>) {
+    return B::gt(values, pivot);
+  } else {
+    return B::gt(values, pivot) | B::eq(values, pivot);
+  }
+}
+
+template <typename T>
+[[nodiscard]] auto lanes(std::span<const T> values) noexcept {
+  using value_type = typename BatchOf<typename T::type>::value_type;
+  return reinterpret_cast<const value_type*>(
+      as_underlying_span(values).data());
+}
+
+template <typename T>
+[[nodiscard]] auto lane(const T& value) noexcept {
+  using value_type = typename BatchOf<typename T::type>::value_type;
+  return static_cast<value_type>(value.get());
+}
+
+/**
+ * @brief Index of the first element for which op(element, pivot) holds
+ */
+template <typename T, typename op>
+[[nodiscard]] auto findIndex(std::span<const T> values, const T& pivot,
+                             op compare) -> std::size_t {
+  std::size_t i = 0;
+  if constexpr (isSimdStrongType<T> && isSimdComparison<op>) {
+    using B = BatchOf<typename T::type>;
+    const auto* data = lanes(values);
+    const auto broadcast = B::set1(lane(pivot));
+    for (; i + B::width <= values.size(); i += B::width) {
+      if (const auto mask = compareBatch<B, op>(B::load(data + i), broadcast);
+          mask != 0) {
+        return i + static_cast<std::size_t>(std::countr_zero(mask));
+      }
+    }
+  }
+  for (; i < values.size(); ++i) {
+    if (compare(values[i], pivot)) {
+      return i;
+    }
+  }
+  return values.size();
+}
+
+/**
+ * @brief Index of the first minimum (or maximum) like std::min_element
+ */
+template <bool isMax, typename T>
+[[nodiscard]] auto extremeIndex(std::span<const T> values) -> std::size_t {
+  if constexpr (isSimdStrongType<T>) {
+    using B = BatchOf<typename T::type>;
+    if (values.size() >= B::width) {
+      const auto* data = lanes(values);
+      // std::min_element keeps a leading NaN and skips every later one, min
+      // and max return their second operand for NaN so the accumulator is it
+      if (!(data[0] == data[0])) {
+        return 0;
+      }
+      auto extreme = B::set1(data[0]);
+      std::size_t i = 0;
+      for (; i + B::width <= values.size(); i += B::width) {
+        extreme = isMax ? B::max(B::load(data + i), extreme)
+                        : B::min(B::load(data + i), extreme);
+      }
+      typename B::value_type buffer[B::width];
+      B::store(buffer, extreme);
+      auto best = buffer[0];
+      for (const auto value : buffer) {
+        best = isMax ? std::max(best, value) : std::min(best, value);
+      }
+      for (; i < values.size(); ++i) {
+        best = isMax ? std::max(best, data[i]) : std::min(best, data[i]);
+      }
+      const auto broadcast = B::set1(best);
+      i = 0;
+      for (; i + B::width <= values.size(); i += B::width) {
+        if (const auto mask = B::eq(B::load(data + i), broadcast); mask != 0) {
+          return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+      }
+      for (; i < values.size(); ++i) {
+        if (data[i] == best) {
+          return i;
+        }
+      }
+    }
+  }
+  const auto it =
+      isMax ? std::max_element(values.begin(), values.end(), std::less<>{})
+            : std::min_element(values.begin(), values.end(), std::less<>{});
+  return static_cast<std::size_t>(it - values.begin());
+}
+
+/**
+ * @brief If a bound of a range validator is exactly representable in the
+ * lanes of type, otherwise the scalar check is needed
+ */
+template <typename type, typename bound>
+[[nodiscard]] constexpr auto isLaneBound(bound value) noexcept -> bool {
+  if constexpr (std::is_integral_v<type> && std::is_integral_v<bound>) {
+    return std::in_range<type>(value);
+  } else if constexpr (std::is_arithmetic_v<bound>) {
+    return static_cast<bound>(static_cast<type>(value)) == value;
+  } else {
+    return false;
+  }
+}
+
+template <typename validator>
+struct isInRangeSpecialization : std::false_type {};
+template <auto minimum, auto maximum>
+struct isInRangeSpecialization<InRange<minimum, maximum>> : std::true_type {};
+
+/**
+ * @brief Concept of a strong::InRange validator, which can be checked with the
+ * SIMD kernels for values of type. Other validators with min and max members
+ * may have further rules, so they are checked via isValid
+ */
+template <typename validator, typename type>
+concept isSimdRangeValidator =
+    hasBatch<type> && isInRangeSpecialization<validator>::value &&
+    isLaneBound<type>(validator::min) && isLaneBound<type>(validator::max);
+}  // namespace detail
+
+/**
+ * @brief Number of elements equal to value. Only available if the config of
+ * the StrongType enables operator==
+ * @param values strong values
+ * @param value value to count
+ * @return number of equal elements
+ */
+template <typename T>
+  requires isEqualComparable<T>
+[[nodiscard]] auto count_equal(std::span<const std::type_identity_t<T>> values,
+                               const T& value) -> std::size_t {
+  std::size_t count = 0;
+  std::size_t i = 0;
+  if constexpr (detail::isSimdStrongType<T>) {
+    using B = detail::BatchOf<typename T::type>;
+    const auto* data = detail::lanes(values);
+    const auto broadcast = B::set1(detail::lane(value));
+    for (; i + B::width <= values.size(); i += B::width) {
+      count += static_cast<std::size_t>(
+          std::popcount(B::eq(B::load(data + i), broadcast)));
+    }
+  }
+  for (; i < values.size(); ++i) {
+    count += values[i] == value ? 1 : 0;
+  }
+  return count;
+}
+
+/**
+ * @brief First element which is less than value. Only available if the config
+ * of the StrongType enables operator< (directly or via spaceship)
+ * @param values strong values
+ * @param value value to compare with
+ * @return iterator to the element or end
+ */
+template <typename T>
+  requires isLessThenComparable<T>
+[[nodiscard]] auto find_if_less(std::span<const std::type_identity_t<T>> values,
+                                const T& value) ->
+    typename std::span<const T>::iterator {
+  return values.begin() + static_cast<std::ptrdiff_t>(detail::findIndex(
+                              values, value, std::less<>{}));
+}
+
+/**
+ * @brief First element which is greater than value. Only available if the
+ * config of the StrongType enables operator> (directly or via spaceship)
+ * @param values strong values
+ * @param value value to compare with
+ * @return iterator to the element or end
+ */
+template <typename T>
+  requires isGreaterThenComparable<T>
+[[nodiscard]] auto find_if_greater(
+    std::span<const std::type_identity_t<T>> values, const T& value) ->
+    typename std::span<const T>::iterator {
+  return values.begin() + static_cast<std::ptrdiff_t>(detail::findIndex(
+                              values, value, std::greater<>{}));
+}
+
+/**
+ * @brief Bitmask of compare(element, pivot) for every element, element i is
+ * bit i % 64 of word i / 64. The comparison has to be enabled by the config,
+ * std::equal_to<>, std::less<>, ... use SIMD kernels
+ * @param values strong values
+ * @param pivot value to compare with
+ * @param compare comparison function object
+ * @param mask output, needs (values.size() + 63) / 64 words
+ */
+template <typename T, typename op>
+  requires std::predicate<const op&, const T&, const T&>
+void compare_mask(std::span<const std::type_identity_t<T>> values,
+                  const T& pivot, op compare, std::span<std::uint64_t> mask) {
+  std::size_t i = 0;
+  if constexpr (detail::isSimdStrongType<T> && detail::isSimdComparison<op>) {
+    using B = detail::BatchOf<typename T::type>;
+    const auto* data = detail::lanes(values);
+    const auto broadcast = B::set1(detail::lane(pivot));
+    for (; i + 64 <= values.size(); i += 64) {
+      std::uint64_t word = 0;
+      for (std::size_t j = 0; j < 64; j += B::width) {
+        word |= detail::compareBatch<B, op>(B::load(data + i + j), broadcast)
+                << j;
+      }
+      mask[i / 64] = word;
+    }
+  }
+  for (; i < values.size(); i += 64) {
+    std::uint64_t word = 0;
+    const auto end = std::min(values.size(), i + 64);
+    for (auto j = i; j < end; ++j) {
+      word |= static_cast<std::uint64_t>(compare(values[j], pivot) ? 1 : 0)
+              << (j - i);
+    }
+    mask[i / 64] = word;
+  }
+}
+/**
+ * @brief Bitmask of compare(element, pivot) for every element, element i is
+ * bit i % 64 of word i / 64
+ * @param values strong values
+ * @param pivot value to compare with
+ * @param compare comparison function object
+ * @return bitmask
+ */
+template <typename T, typename op>
+  requires std::predicate<const op&, const T&, const T&>
+[[nodiscard]] auto compare_mask(
+    std::span<const std::type_identity_t<T>> values, const T& pivot,
+    op compare) -> std::vector<std::uint64_t> {
+  std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+  compare_mask<T>(values, pivot, compare, std::span{mask});
+  return mask;
+}
+
+/**
+ * @brief First smallest element like std::min_element. Only available if the
+ * config of the StrongType enables operator< (directly or via spaceship)
+ * @param values strong values
+ * @return iterator to the element or end if empty
+ */
+template <typename T>
+  requires isLessThenComparable<T>
+[[nodiscard]] auto min_element(std::span<const T> values) ->
+    typename std::span<const T>::iterator {
+  return values.begin() +
+         static_cast<std::ptrdiff_t>(detail::extremeIndex<false>(values));
+}
+/**
+ * @brief First largest element like std::max_element. Only available if the
+ * config of the StrongType enables operator< (directly or via spaceship)
+ * @param values strong values
+ * @return iterator to the element or end if empty
+ */
+template <typename T>
+  requires isLessThenComparable<T>
+[[nodiscard]] auto max_element(std::span<const T> values) ->
+    typename std::span<const T>::iterator {
+  return values.begin() +
+         static_cast<std::ptrdiff_t>(detail::extremeIndex<true>(values));
+}
+/**
+ * @brief First smallest element of a contiguous range like std::min_element
+ * @param values strong values
+ * @return iterator to the element or end if empty
+ */
+template <std::ranges::contiguous_range range>
+  requires isLessThenComparable<std::ranges::range_value_t<range>>
+[[nodiscard]] auto min_element(const range& values) {
+  return min_element(
+      std::span<const std::ranges::range_value_t<range>>{values});
+}
+/**
+ * @brief First largest element of a contiguous range like std::max_element
+ * @param values strong values
+ * @return iterator to the element or end if empty
+ */
+template <std::ranges::contiguous_range range>
+  requires isLessThenComparable<std::ranges::range_value_t<range>>
+[[nodiscard]] auto max_element(const range& values) {
+  return max_element(
+      std::span<const std::ranges::range_value_t<range>>{values});
+}
+
+/**
+ * @brief Index of the first value rejected by the validator of T, e.g. to
+ * check deserialized values once before they are viewed via as_strong_span
+ * or constructed with strong::unchecked. Range validators are checked with
+ * SIMD
+ * @tparam T StrongType with a validator
+ * @param values underlying values
+ * @return index of the first invalid value or values.size() if all are valid
+ */
+template <isStrongType T>
+  requires isValidationEnabled<typename T::config_type>
+[[nodiscard]] auto find_invalid(
+    std::span<const std::type_identity_t<typename T::type>> values)
+    -> std::size_t {
+  using validator = typename T::config_type::validator;
+  std::size_t i = 0;
+  if constexpr (detail::isSimdRangeValidator<validator, typename T::type>) {
+    using B = detail::BatchOf<typename T::type>;
+    using value_type = typename B::value_type;
+    const auto* data = reinterpret_cast<const value_type*>(values.data());
+    const auto min = B::set1(static_cast<value_type>(validator::min));
+    const auto max = B::set1(static_cast<value_type>(validator::max));
+    for (; i + B::width <= values.size(); i += B::width) {
+      const auto batch = B::load(data + i);
+      // NaN fails every comparison, so it is invalid like in the scalar check
+      const auto valid = (B::gt(batch, min) | B::eq(batch, min)) &
+                         (B::lt(batch, max) | B::eq(batch, max));
+      if (const auto invalid = ~valid & detail::laneMask<B>; invalid != 0) {
+        return i + static_cast<std::size_t>(std::countr_zero(invalid));
+      }
+    }
+  }
+  for (; i < values.size(); ++i) {
+    if (!validator::isValid(values[i])) {
+      return i;
+    }
+  }
+  return values.size();
+}
+/**
+ * @brief If every value is accepted by the validator of T
+ * @tparam T StrongType with a validator
+ * @param values underlying values
+ * @return true if all values are valid
+ */
+template <isStrongType T>
+  requires isValidationEnabled<typename T::config_type>
+[[nodiscard]] auto all_valid(
+    std::span<const std::type_identity_t<typename T::type>> values) -> bool {
+  return find_invalid<T>(values) == values.size();
+}
+}  // namespace strong
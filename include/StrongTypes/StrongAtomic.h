@@ -0,0 +1,263 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace strong {
+/**
+ * @brief Size of a cache line assumed to keep independently written atomics
+ * apart
+ */
+inline constexpr std::size_t cacheLineSize = 64;
+}  // namespace strong
+
+/**
+ * @brief Atomic StrongType, all operations take and return the StrongType.
+ * The value is held as its storage type, so a compressed StrongType stays
+ * narrow. fetch_add / fetch_sub need the addSubtract flag and are not
+ * available if construction is checked (validator or compression), as the
+ * result can't be validated. fetch_max / fetch_min need operator<
+ * @tparam config config of the StrongType
+ */
+template <isStrongTypeConfig config>
+class StrongAtomic {
+ public:
+  using value_type = StrongType<config>;
+  using type = typename value_type::type;
+  using storage_type = typename value_type::storage_type;
+
+  static_assert(std::is_trivially_copyable_v<storage_type>,
+                "StrongAtomic needs a trivially copyable underlying type");
+
+  static constexpr bool is_always_lock_free =
+      std::atomic<storage_type>::is_always_lock_free;
+
+  /**
+   * @brief Zero initialized, not available with a validator, as zero could be
+   * invalid
+   */
+  StrongAtomic() noexcept
+    requires(!isValidationEnabled<config>)
+  = default;
+  constexpr explicit StrongAtomic(const value_type& initial) noexcept
+      : raw{toRaw(initial)} {}
+  StrongAtomic(const StrongAtomic&) = delete;
+  auto operator=(const StrongAtomic&) -> StrongAtomic& = delete;
+
+  [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst)
+      const noexcept -> value_type {
+    return fromRaw(raw.load(order));
+  }
+  void store(const value_type& desired,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    raw.store(toRaw(desired), order);
+  }
+  auto exchange(const value_type& desired,
+                std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> value_type {
+    return fromRaw(raw.exchange(toRaw(desired), order));
+  }
+  /**
+   * @brief Replaces the value if it still is expected, otherwise expected is
+   * updated to the current one
+   * @return true if replaced
+   */
+  auto compare_exchange_weak(
+      value_type& expected, const value_type& desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    auto current = toRaw(expected);
+    const bool exchanged =
+        raw.compare_exchange_weak(current, toRaw(desired), order);
+    expected = fromRaw(current);
+    return exchanged;
+  }
+  auto compare_exchange_strong(
+      value_type& expected, const value_type& desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    auto current = toRaw(expected);
+    const bool exchanged =
+        raw.compare_exchange_strong(current, toRaw(desired), order);
+    expected = fromRaw(current);
+    return exchanged;
+  }
+
+  /**
+   * @brief Adds a value, integers wrap around like std::atomic
+   * @return the previous value
+   */
+  auto fetch_add(const value_type& delta,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> value_type
+    requires isAddSubtractEnabled<config> &&
+             (!isConstructionChecked<config>) &&
+             requires(std::atomic<storage_type> atomic, storage_type value) {
+               atomic.fetch_add(value);
+             }
+  {
+    return fromRaw(raw.fetch_add(toRaw(delta), order));
+  }
+  /**
+   * @brief Subtracts a value, integers wrap around like std::atomic
+   * @return the previous value
+   */
+  auto fetch_sub(const value_type& delta,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> value_type
+    requires isAddSubtractEnabled<config> &&
+             (!isConstructionChecked<config>) &&
+             requires(std::atomic<storage_type> atomic, storage_type value) {
+               atomic.fetch_sub(value);
+             }
+  {
+    return fromRaw(raw.fetch_sub(toRaw(delta), order));
+  }
+  /**
+   * @brief Raises the value to at least value, e.g. a high water mark. Only
+   * writes if the value is raised
+   * @return the previous value
+   */
+  auto fetch_max(const value_type& value,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> value_type
+    requires isLessThenComparable<value_type>
+  {
+    auto current = raw.load(std::memory_order_relaxed);
+    while (fromRaw(current) < value &&
+           !raw.compare_exchange_weak(current, toRaw(value), order,
+                                      std::memory_order_relaxed)) {
+    }
+    return fromRaw(current);
+  }
+  /**
+   * @brief Lowers the value to at most value. Only writes if the value is
+   * lowered
+   * @return the previous value
+   */
+  auto fetch_min(const value_type& value,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> value_type
+    requires isLessThenComparable<value_type>
+  {
+    auto current = raw.load(std::memory_order_relaxed);
+    while (value < fromRaw(current) &&
+           !raw.compare_exchange_weak(current, toRaw(value), order,
+                                      std::memory_order_relaxed)) {
+    }
+    return fromRaw(current);
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto toRaw(const value_type& value) noexcept
+      -> storage_type {
+    return static_cast<storage_type>(value.get());
+  }
+  [[nodiscard]] static constexpr auto fromRaw(storage_type value) noexcept
+      -> value_type {
+    return value_type{strong::unchecked, static_cast<type>(value)};
+  }
+
+  std::atomic<storage_type> raw{};
+};
+
+/**
+ * @brief StrongAtomic alone on its cache line, so writes to it don't slow down
+ * neighbouring data (false sharing), e.g. in an array of per shard counters
+ * @tparam config config of the StrongType
+ */
+template <isStrongTypeConfig config>
+class alignas(strong::cacheLineSize) StrongPaddedAtomic
+    : public StrongAtomic<config> {
+ public:
+  using StrongAtomic<config>::StrongAtomic;
+};
+
+namespace strong::detail {
+/**
+ * @brief Shard of the calling thread, threads are assigned round robin on
+ * their first call, so up to shardCount threads never share a shard
+ */
+[[nodiscard]] inline auto threadShardIndex() noexcept -> std::size_t {
+  static std::atomic<std::size_t> threads{0};
+  thread_local const std::size_t index =
+      threads.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+}  // namespace strong::detail
+
+/**
+ * @brief Counter for contended increments: every thread adds to its own cache
+ * line and load() sums all shards. add() is a single uncontended atomic
+ * add, load() is O(shards) and not a snapshot while other threads add
+ * @tparam config config of the StrongType, needs the addSubtract flag and an
+ * integral underlying type without checked construction
+ */
+template <isStrongTypeConfig config>
+  requires isAddSubtractEnabled<config> &&
+           std::is_integral_v<typename config::underlyingType> &&
+           (!isConstructionChecked<config>)
+class StrongShardedCounter {
+ public:
+  using value_type = StrongType<config>;
+  using type = typename value_type::type;
+
+  /**
+   * @brief Creates a zero counter
+   * @param shards number of shards, rounded up to a power of 2, by default
+   * one per hardware thread
+   */
+  explicit StrongShardedCounter(
+      std::size_t shards = std::thread::hardware_concurrency())
+      : mask{std::bit_ceil(shards == 0 ? std::size_t{1} : shards) - 1},
+        counters{std::make_unique<StrongPaddedAtomic<config>[]>(mask + 1)} {}
+  StrongShardedCounter(const StrongShardedCounter&) = delete;
+  auto operator=(const StrongShardedCounter&)
+      -> StrongShardedCounter& = delete;
+
+  /**
+   * @brief Adds to the shard of the calling thread, no ordering with other
+   * memory operations
+   */
+  void add(const value_type& delta) noexcept {
+    counters[strong::detail::threadShardIndex() & mask].fetch_add(
+        delta, std::memory_order_relaxed);
+  }
+  void sub(const value_type& delta) noexcept {
+    counters[strong::detail::threadShardIndex() & mask].fetch_sub(
+        delta, std::memory_order_relaxed);
+  }
+  /**
+   * @brief Sum of all shards, exact once the adding threads are joined
+   */
+  [[nodiscard]] auto load() const noexcept -> value_type {
+    // shards wrap around on their own, so does the sum
+    using unsignedType = std::make_unsigned_t<type>;
+    unsignedType sum = 0;
+    for (std::size_t i = 0; i <= mask; ++i) {
+      sum = static_cast<unsignedType>(
+          sum + static_cast<unsignedType>(
+                    counters[i].load(std::memory_order_relaxed).get()));
+    }
+    return value_type{strong::unchecked, static_cast<type>(sum)};
+  }
+  /**
+   * @brief Sets all shards to zero, must not race with add()
+   */
+  void reset() noexcept {
+    for (std::size_t i = 0; i <= mask; ++i) {
+      counters[i].store(value_type{}, std::memory_order_relaxed);
+    }
+  }
+  [[nodiscard]] auto shardCount() const noexcept -> std::size_t {
+    return mask + 1;
+  }
+
+ private:
+  std::size_t mask;
+  std::unique_ptr<StrongPaddedAtomic<config>[]> counters;
+};
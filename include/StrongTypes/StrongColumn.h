@@ -0,0 +1,372 @@
+#pragma once
+#include <StrongTypes/StrongAlgorithms.h>
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Concept of StrongTypes whose values are written and mapped as raw
+ * bytes by write_column and MappedStrongColumn. With a validator the type
+ * needs a standard layout, so the mapped values can be checked in place
+ */
+template <typename T>
+concept isColumnStrongType =
+    isStrongType<T> && std::is_trivially_copyable_v<T> &&
+    (!isValidationEnabled<typename T::config_type> ||
+     std::is_standard_layout_v<T>);
+
+namespace strong {
+/**
+ * @brief Header in front of the payload of a column file, written in native
+ * byte order. It is 64 bytes, so the payload of a mapped file is aligned for
+ * every element
+ */
+struct ColumnHeader {
+  static constexpr std::array<char, 8> expectedMagic{'S', 'T', 'R', 'O',
+                                                     'N', 'G', 'C', '1'};
+  static constexpr std::uint32_t nativeEndianness = 0x01020304;
+
+  std::array<char, 8> magic = expectedMagic;
+  std::uint64_t fingerprint = 0;
+  std::uint32_t elementSize = 0;
+  std::uint32_t endianness = nativeEndianness;
+  std::uint64_t count = 0;
+  std::array<std::byte, 32> reserved{};
+};
+static_assert(sizeof(ColumnHeader) == 64);
+static_assert(std::is_trivially_copyable_v<ColumnHeader>);
+
+namespace detail {
+template <typename T>
+[[nodiscard]] consteval auto typeName() -> std::string_view {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+[[nodiscard]] constexpr auto fnv1a(std::string_view text,
+                                   std::uint64_t hash = 0xcbf29ce484222325)
+    -> std::uint64_t {
+  for (const char c : text) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+  }
+  return hash;
+}
+}  // namespace detail
+
+/**
+ * @brief Fingerprint of a config in a column file, by default a hash of the
+ * name of the config and its storage type. A config can pin it via
+ * static constexpr std::uint64_t fingerprint = ...;
+ * e.g. to rename the config and keep reading its files. The default differs
+ * between compilers, as it hashes the compiler's spelling of the names
+ */
+template <typename config>
+[[nodiscard]] consteval auto configFingerprint() -> std::uint64_t {
+  if constexpr (requires() {
+                  { config::fingerprint } -> std::convertible_to<
+                                               std::uint64_t>;
+                }) {
+    return config::fingerprint;
+  } else {
+    using storage = typename StrongType<config>::storage_type;
+    return detail::fnv1a(detail::typeName<storage>(),
+                         detail::fnv1a(detail::typeName<config>()));
+  }
+}
+
+/**
+ * @brief Writes a column of StrongTypes: the header, then the values with a
+ * single write
+ * @param path file to create or replace
+ * @param values values to write
+ * @throw std::system_error if the file can't be written
+ */
+template <isColumnStrongType T>
+void write_column(const std::filesystem::path& path,
+                  std::span<const T> values) {
+  ColumnHeader header;
+  header.fingerprint = configFingerprint<typename T::config_type>();
+  header.elementSize = sizeof(T);
+  header.count = values.size();
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  if (!file.is_open()) {
+    throw std::system_error(errno, std::generic_category(),
+                            "write_column: can't open " + path.string());
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(values.data()),
+             static_cast<std::streamsize>(values.size_bytes()));
+  file.close();
+  if (!file) {
+    // the streams don't report why a write failed
+    throw std::system_error(std::make_error_code(std::errc::io_error),
+                            "write_column: can't write " + path.string());
+  }
+}
+
+namespace detail {
+/**
+ * @brief Checks the header of a column file of size bytes against T
+ * @return number of values in the file
+ * @throw std::runtime_error if the file doesn't hold a column of T
+ */
+template <isColumnStrongType T>
+auto checkColumnHeader(const std::byte* file, std::size_t size)
+    -> std::size_t {
+  ColumnHeader header;
+  if (size < sizeof(header)) {
+    throw std::runtime_error("StrongColumn: file too small for a header");
+  }
+  std::memcpy(&header, file, sizeof(header));
+  if (header.magic != ColumnHeader::expectedMagic) {
+    throw std::runtime_error("StrongColumn: no column file");
+  }
+  if (header.endianness != ColumnHeader::nativeEndianness) {
+    throw std::runtime_error("StrongColumn: foreign byte order");
+  }
+  if (header.fingerprint != configFingerprint<typename T::config_type>() ||
+      header.elementSize != sizeof(T)) {
+    throw std::runtime_error("StrongColumn: column of another StrongType");
+  }
+  if (header.count > (size - sizeof(header)) / sizeof(T)) {
+    throw std::runtime_error("StrongColumn: file shorter than its count");
+  }
+  return static_cast<std::size_t>(header.count);
+}
+
+/**
+ * @brief Index of the first value of a mapped payload rejected by the
+ * validator of T, as get() assumes every value to be valid
+ * @param payload values after the header
+ * @param count number of values
+ * @return index of the first invalid value or count if all are valid
+ */
+template <isColumnStrongType T>
+  requires isValidationEnabled<typename T::config_type>
+auto findInvalidColumnValue(const std::byte* payload, std::size_t count)
+    -> std::size_t {
+  using type = typename T::type;
+  using storage_type = typename T::storage_type;
+  if constexpr (isLayoutCompatibleStrongType<T>) {
+    return find_invalid<T>(
+        std::span{reinterpret_cast<const type*>(payload), count});
+  } else {
+    // a compressed value, standard layout puts its storage at offset 0
+    using validator = typename T::config_type::validator;
+    for (std::size_t i = 0; i < count; ++i) {
+      storage_type raw;
+      std::memcpy(&raw, payload + i * sizeof(T), sizeof(raw));
+      if (!validator::isValid(static_cast<type>(raw))) {
+        return i;
+      }
+    }
+    return count;
+  }
+}
+
+/**
+ * @brief Read only mapping of a whole file
+ */
+class FileMapping {
+ public:
+  FileMapping() noexcept = default;
+  explicit FileMapping(const std::filesystem::path& path) {
+#if defined(_WIN32)
+    const HANDLE file =
+        CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      throwError(lastError(), path);
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+      const auto error = lastError();
+      CloseHandle(file);
+      throwError(error, path);
+    }
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+    const HANDLE mapping =
+        CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    auto error = lastError();
+    CloseHandle(file);
+    if (mapping == nullptr) {
+      throwError(error, path);
+    }
+    // the view keeps the mapping alive
+    address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    error = lastError();
+    CloseHandle(mapping);
+    if (address == nullptr) {
+      throwError(error, path);
+    }
+#else
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) {
+      throwError(lastError(), path);
+    }
+    struct stat status;
+    if (::fstat(file, &status) != 0) {
+      const auto error = lastError();
+      ::close(file);
+      throwError(error, path);
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    if (size != 0) {
+      address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+      if (address == MAP_FAILED) {
+        const auto error = lastError();
+        address = nullptr;
+        ::close(file);
+        throwError(error, path);
+      }
+    }
+    // the mapping keeps the file alive
+    ::close(file);
+#endif
+  }
+  FileMapping(FileMapping&& other) noexcept
+      : address{std::exchange(other.address, nullptr)},
+        size{std::exchange(other.size, 0)} {}
+  auto operator=(FileMapping&& other) noexcept -> FileMapping& {
+    if (this != &other) {
+      unmap();
+      address = std::exchange(other.address, nullptr);
+      size = std::exchange(other.size, 0);
+    }
+    return *this;
+  }
+  ~FileMapping() { unmap(); }
+
+  [[nodiscard]] auto bytes() const noexcept -> const std::byte* {
+    return static_cast<const std::byte*>(address);
+  }
+  [[nodiscard]] auto bytesSize() const noexcept -> std::size_t { return size; }
+
+ private:
+  [[nodiscard]] static auto lastError() noexcept -> std::error_code {
+#if defined(_WIN32)
+    return {static_cast<int>(GetLastError()), std::system_category()};
+#else
+    return {errno, std::generic_category()};
+#endif
+  }
+  [[noreturn]] static void throwError(std::error_code error,
+                                      const std::filesystem::path& path) {
+    throw std::system_error(error, "StrongColumn: can't map " + path.string());
+  }
+  void unmap() noexcept {
+    if (address != nullptr) {
+#if defined(_WIN32)
+      UnmapViewOfFile(address);
+#else
+      ::munmap(address, size);
+#endif
+    }
+  }
+
+  void* address = nullptr;
+  std::size_t size = 0;
+};
+}  // namespace detail
+}  // namespace strong
+
+/**
+ * @brief Column file of write_column mapped into memory. The values are
+ * accessed in place: nothing is copied or parsed when the column is opened,
+ * pages are read on first access. Only values with a validator are checked
+ * once on open, which reads the whole file
+ * @tparam T trivially copyable StrongType
+ */
+template <isColumnStrongType T>
+class MappedStrongColumn {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = typename std::span<const T>::iterator;
+
+  /**
+   * @brief Maps a column file
+   * @param path file written by write_column
+   * @throw std::system_error if the file can't be mapped
+   * @throw std::runtime_error if the file is no column of T, e.g. the
+   * fingerprint of its config doesn't match, or a value is rejected by the
+   * validator of T
+   */
+  explicit MappedStrongColumn(const std::filesystem::path& path)
+      : mapping{path} {
+    const auto count = strong::detail::checkColumnHeader<T>(
+        mapping.bytes(), mapping.bytesSize());
+    const auto* payload = mapping.bytes() + sizeof(strong::ColumnHeader);
+    if constexpr (isValidationEnabled<typename T::config_type>) {
+      const auto invalid =
+          strong::detail::findInvalidColumnValue<T>(payload, count);
+      if (invalid != count) {
+        throw std::runtime_error("StrongColumn: invalid value at offset " +
+                                 std::to_string(invalid));
+      }
+    }
+    values = {reinterpret_cast<const T*>(payload), count};
+  }
+  MappedStrongColumn(MappedStrongColumn&& other) noexcept
+      : mapping{std::move(other.mapping)},
+        values{std::exchange(other.values, {})} {}
+  auto operator=(MappedStrongColumn&& other) noexcept -> MappedStrongColumn& {
+    mapping = std::move(other.mapping);
+    values = std::exchange(other.values, {});
+    return *this;
+  }
+
+  [[nodiscard]] auto span() const noexcept -> std::span<const T> {
+    return values;
+  }
+  [[nodiscard]] auto data() const noexcept -> const T* {
+    return values.data();
+  }
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return values.size();
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return values.empty(); }
+  [[nodiscard]] auto operator[](size_type index) const noexcept -> const T& {
+    return values[index];
+  }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return values.begin();
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return values.end();
+  }
+
+ private:
+  strong::detail::FileMapping mapping;
+  std::span<const T> values;
+};
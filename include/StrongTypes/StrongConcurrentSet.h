@@ -0,0 +1,284 @@
+#pragma once
+#include <StrongTypes/StrongAtomic.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Concept of the keys of StrongConcurrentSet: trivially copyable
+ * StrongTypes over an integer whose config enables equal
+ */
+template <typename T>
+concept isConcurrentSetKey =
+    isStrongType<T> && T::config_type::equal &&
+    std::is_trivially_copyable_v<T> &&
+    std::is_integral_v<typename T::type> &&
+    !std::is_same_v<typename T::type, bool>;
+
+/**
+ * @brief Lock free insert only hash set of integral StrongTypes, e.g. to
+ * de-duplicate ids across threads. Every slot is an atomic integer claimed
+ * with a single compare exchange (linear probing). A full table isn't
+ * rehashed under a lock: a table of twice the size is chained behind it,
+ * new keys go there and every insert moves a chunk of the old keys over, so
+ * growing never stops the other threads. Keys are never erased, the tables
+ * grown out of are freed with the set
+ * @tparam Key StrongType over an integer, the config needs equal
+ */
+template <isConcurrentSetKey Key>
+class StrongConcurrentSet {
+  using raw_type = std::make_unsigned_t<typename Key::type>;
+
+  // values of a slot, keys with these values are kept in flags
+  static constexpr raw_type emptySlot = 0;
+  static constexpr raw_type sealedSlot = std::numeric_limits<raw_type>::max();
+  // slots moved to the next table by one insert
+  static constexpr std::size_t migrationChunk = 256;
+
+  // the slots are value initialized, i.e. empty
+  struct Table {
+    explicit Table(std::size_t capacity)
+        : mask{capacity - 1},
+          chunks{(capacity + migrationChunk - 1) / migrationChunk},
+          slots{std::make_unique<std::atomic<raw_type>[]>(capacity)} {}
+
+    const std::size_t mask;
+    const std::size_t chunks;
+    std::unique_ptr<std::atomic<raw_type>[]> slots;
+    alignas(strong::cacheLineSize) std::atomic<std::size_t> count{0};
+    std::atomic<Table*> next{nullptr};
+    // progress of moving the keys to next
+    std::atomic<std::size_t> claimedChunks{0};
+    std::atomic<std::size_t> movedChunks{0};
+    std::atomic<std::size_t> movedKeys{0};
+  };
+
+  enum class Probe { found, inserted, next };
+
+ public:
+  using value_type = Key;
+  using size_type = std::size_t;
+
+  static_assert(std::atomic<raw_type>::is_always_lock_free);
+
+  /**
+   * @brief Creates an empty set
+   * @param capacity expected number of keys, the set grows beyond it
+   */
+  explicit StrongConcurrentSet(size_type capacity = 1024)
+      : first{std::make_unique<Table>(std::bit_ceil(
+            std::max<size_type>(capacity + capacity / 2, 16)))},
+        current{first.get()} {}
+  StrongConcurrentSet(const StrongConcurrentSet&) = delete;
+  auto operator=(const StrongConcurrentSet&) -> StrongConcurrentSet& = delete;
+  ~StrongConcurrentSet() {
+    auto* table = first->next.load(std::memory_order_acquire);
+    while (table != nullptr) {
+      delete std::exchange(table, table->next.load(std::memory_order_acquire));
+    }
+  }
+
+  /**
+   * @brief Inserts the key if no thread has inserted it before, lock free
+   * @param key key to insert
+   * @return true if the key is new, exactly one of several threads inserting
+   * the same key gets true
+   */
+  auto insert(const Key& key) -> bool {
+    const auto raw = static_cast<raw_type>(key.get());
+    if (raw == emptySlot || raw == sealedSlot) {
+      return !reservedFlag(raw).exchange(true, std::memory_order_acq_rel);
+    }
+    auto* table = current.load(std::memory_order_acquire);
+    const bool inserted = insertFrom(table, raw) == Probe::inserted;
+    if (table->next.load(std::memory_order_acquire) != nullptr) {
+      moveChunk(*table);
+    }
+    return inserted;
+  }
+  /**
+   * @brief If the key has been inserted, lock free
+   */
+  [[nodiscard]] auto contains(const Key& key) const noexcept -> bool {
+    const auto raw = static_cast<raw_type>(key.get());
+    if (raw == emptySlot || raw == sealedSlot) {
+      return reservedFlag(raw).load(std::memory_order_acquire);
+    }
+    const auto hash = strong::mixHash(raw);
+    for (const Table* table = current.load(std::memory_order_acquire);
+         table != nullptr;
+         table = table->next.load(std::memory_order_acquire)) {
+      for (size_type i = 0, index = hash & table->mask; i <= table->mask;
+           ++i, index = (index + 1) & table->mask) {
+        const auto slot = table->slots[index].load(std::memory_order_acquire);
+        if (slot == raw) {
+          return true;
+        }
+        if (slot == emptySlot) {
+          // an insert into a later table would have sealed this slot
+          return false;
+        }
+        if (slot == sealedSlot) {
+          break;
+        }
+      }
+    }
+    return false;
+  }
+  /**
+   * @brief Number of keys, only exact while no thread inserts
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    size_type count = (hasEmptyKey.load(std::memory_order_relaxed) ? 1 : 0) +
+                      (hasSealedKey.load(std::memory_order_relaxed) ? 1 : 0);
+    // moved keys are in two tables
+    for (const Table* table = first.get(); table != nullptr;
+         table = table->next.load(std::memory_order_acquire)) {
+      count += table->count.load(std::memory_order_relaxed) -
+               table->movedKeys.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+  /**
+   * @brief Slots of the table lookups start at
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return current.load(std::memory_order_acquire)->mask + 1;
+  }
+  /**
+   * @brief Number of tables a lookup may probe, 1 unless the set is growing
+   */
+  [[nodiscard]] auto tableCount() const noexcept -> size_type {
+    size_type count = 0;
+    for (const Table* table = current.load(std::memory_order_acquire);
+         table != nullptr;
+         table = table->next.load(std::memory_order_acquire)) {
+      ++count;
+    }
+    return count;
+  }
+
+ private:
+  /**
+   * @brief Inserts into table or a later one
+   */
+  static auto insertFrom(Table* table, raw_type raw) -> Probe {
+    const auto hash = strong::mixHash(raw);
+    while (true) {
+      const auto probe = insertInto(*table, raw, hash);
+      if (probe != Probe::next) {
+        return probe;
+      }
+      table = nextTable(table);
+    }
+  }
+  /**
+   * @brief Probes a table up to the first free slot of the key. The key is
+   * inserted there while the table is below its load limit, otherwise the
+   * slot is sealed, so no other thread can insert the key into this table
+   * after it has been inserted into a later one
+   */
+  static auto insertInto(Table& table, raw_type raw, std::uint64_t hash)
+      -> Probe {
+    const size_type limit = (table.mask + 1) / 4 * 3;
+    for (size_type i = 0, index = hash & table.mask; i <= table.mask;
+         ++i, index = (index + 1) & table.mask) {
+      auto& slot = table.slots[index];
+      auto current = slot.load(std::memory_order_acquire);
+      while (current == emptySlot) {
+        const bool full =
+            table.count.load(std::memory_order_relaxed) >= limit;
+        if (slot.compare_exchange_weak(current, full ? sealedSlot : raw,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+          if (full) {
+            return Probe::next;
+          }
+          table.count.fetch_add(1, std::memory_order_relaxed);
+          return Probe::inserted;
+        }
+      }
+      if (current == raw) {
+        return Probe::found;
+      }
+      if (current == sealedSlot) {
+        return Probe::next;
+      }
+    }
+    // no free slot left, the key can't be inserted into this table anymore
+    return Probe::next;
+  }
+  /**
+   * @brief Table behind table, the first thread to need it creates it with
+   * twice the capacity
+   */
+  static auto nextTable(Table* table) -> Table* {
+    auto* next = table->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+      return next;
+    }
+    auto created = std::make_unique<Table>(2 * (table->mask + 1));
+    if (table->next.compare_exchange_strong(next, created.get(),
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+      return created.release();
+    }
+    return next;
+  }
+  /**
+   * @brief Moves the keys of one chunk of a full table to the next one and
+   * seals its free slots. Once all chunks are moved, lookups start at the
+   * next table
+   */
+  void moveChunk(Table& table) {
+    const auto chunk =
+        table.claimedChunks.fetch_add(1, std::memory_order_relaxed);
+    if (chunk >= table.chunks) {
+      return;
+    }
+    auto* next = table.next.load(std::memory_order_acquire);
+    const auto end = std::min((chunk + 1) * migrationChunk, table.mask + 1);
+    size_type moved = 0;
+    for (auto index = chunk * migrationChunk; index < end; ++index) {
+      auto& slot = table.slots[index];
+      auto key = slot.load(std::memory_order_acquire);
+      while (key == emptySlot &&
+             !slot.compare_exchange_weak(key, sealedSlot,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+      }
+      if (key != emptySlot && key != sealedSlot) {
+        static_cast<void>(insertFrom(next, key));
+        ++moved;
+      }
+    }
+    table.movedKeys.fetch_add(moved, std::memory_order_relaxed);
+    if (table.movedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+        table.chunks) {
+      current.store(next, std::memory_order_release);
+    }
+  }
+  [[nodiscard]] auto reservedFlag(raw_type raw) noexcept
+      -> std::atomic<bool>& {
+    return raw == emptySlot ? hasEmptyKey : hasSealedKey;
+  }
+  [[nodiscard]] auto reservedFlag(raw_type raw) const noexcept
+      -> const std::atomic<bool>& {
+    return raw == emptySlot ? hasEmptyKey : hasSealedKey;
+  }
+
+  std::unique_ptr<Table> first;
+  // oldest table whose keys haven't all been moved
+  std::atomic<Table*> current;
+  std::atomic<bool> hasEmptyKey{false};
+  std::atomic<bool> hasSealedKey{false};
+};
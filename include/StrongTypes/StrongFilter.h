@@ -0,0 +1,635 @@
+#pragma once
+#include <StrongTypes/StrongColumn.h>
+#include <StrongTypes/StrongSimd.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Concept of the keys of StrongBloomFilter and StrongCuckooFilter,
+ * StrongTypes whose config enables hash
+ */
+template <typename T>
+concept isStrongFilterKey =
+    isStrongType<T> && isHashEnabled<typename T::config_type>;
+
+namespace strong {
+/**
+ * @brief Header in front of the bit array of a serialized filter, in native
+ * byte order
+ */
+struct FilterHeader {
+  static constexpr std::array<char, 8> expectedMagic{'S', 'T', 'R', 'O',
+                                                     'N', 'G', 'F', '1'};
+  static constexpr std::uint32_t nativeEndianness = 0x01020304;
+
+  std::array<char, 8> magic = expectedMagic;
+  std::uint64_t fingerprint = 0;
+  // bloom filter 0, cuckoo filter its fingerprint bits
+  std::uint32_t kind = 0;
+  std::uint32_t endianness = nativeEndianness;
+  // blocks or buckets
+  std::uint64_t words = 0;
+  std::uint64_t count = 0;
+  std::uint64_t victimIndex = 0;
+  std::uint64_t victimFingerprint = 0;
+};
+static_assert(sizeof(FilterHeader) == 56);
+static_assert(std::is_trivially_copyable_v<FilterHeader>);
+
+namespace detail {
+/**
+ * @brief 64 bit hash of a key. std::hash of a StrongType mixes integers, but
+ * may be the identity of other underlying types
+ */
+template <isStrongFilterKey Key>
+[[nodiscard]] auto filterHash(const Key& key) noexcept(
+    noexcept(std::hash<Key>{}(key))) -> std::uint64_t {
+  return mixHash(static_cast<std::uint64_t>(std::hash<Key>{}(key)));
+}
+
+/**
+ * @brief Serializes a filter: the header, then the words
+ */
+template <typename Word>
+[[nodiscard]] auto writeFilter(const FilterHeader& header,
+                               std::span<const Word> words)
+    -> std::vector<std::byte> {
+  std::vector<std::byte> bytes(sizeof(header) + words.size_bytes());
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  std::memcpy(bytes.data() + sizeof(header), words.data(), words.size_bytes());
+  return bytes;
+}
+/**
+ * @brief Checks a serialized filter of Key with the given kind
+ * @return its header
+ * @throw std::invalid_argument if the buffer doesn't hold such a filter
+ */
+template <typename Key, typename Word>
+[[nodiscard]] auto readFilterHeader(std::span<const std::byte> bytes,
+                                    std::uint32_t kind) -> FilterHeader {
+  FilterHeader header;
+  if (bytes.size() < sizeof(header)) {
+    throw std::invalid_argument("StrongFilter: buffer too small");
+  }
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != FilterHeader::expectedMagic) {
+    throw std::invalid_argument("StrongFilter: no serialized filter");
+  }
+  if (header.endianness != FilterHeader::nativeEndianness) {
+    throw std::invalid_argument("StrongFilter: foreign byte order");
+  }
+  if (header.fingerprint != configFingerprint<typename Key::config_type>() ||
+      header.kind != kind) {
+    throw std::invalid_argument("StrongFilter: filter of another type");
+  }
+  if (header.words == 0 ||
+      header.words != (bytes.size() - sizeof(header)) / sizeof(Word) ||
+      (bytes.size() - sizeof(header)) % sizeof(Word) != 0) {
+    throw std::invalid_argument("StrongFilter: size doesn't match");
+  }
+  return header;
+}
+
+// keys a batch lookup prefetches ahead, enough to hide a cache miss without
+// running out of line fill buffers
+inline constexpr std::size_t prefetchDistance = 16;
+
+/**
+ * @brief Word of 64 lookup results, result j is bit j
+ */
+[[nodiscard]] inline auto packBits(
+    const std::array<std::uint8_t, 64>& hits) noexcept -> std::uint64_t {
+  std::uint64_t word = 0;
+  for (std::size_t j = 0; j < hits.size(); ++j) {
+    word |= static_cast<std::uint64_t>(hits[j]) << j;
+  }
+  return word;
+}
+
+/**
+ * @brief Hint to load the cache line of address, e.g. of the next lookups
+ */
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address);
+#else
+  static_cast<void>(address);
+#endif
+}
+
+/**
+ * @brief Expected false positive rate of a split block bloom filter: the
+ * keys per block are Poisson distributed, every key sets one bit in each of
+ * the 8 words of its block
+ * @param bitsPerKey bits of the filter per key
+ */
+[[nodiscard]] inline auto blockBloomFalsePositiveRate(double bitsPerKey)
+    -> double {
+  const double keysPerBlock = 256.0 / bitsPerKey;
+  double probability = std::exp(-keysPerBlock);
+  double rate = 0.0;
+  const auto last = static_cast<int>(keysPerBlock * 2.0 + 64.0);
+  for (int keys = 0; keys <= last; ++keys) {
+    rate += probability * std::pow(1.0 - std::pow(31.0 / 32.0, keys), 8.0);
+    probability *= keysPerBlock / (keys + 1);
+  }
+  return rate;
+}
+}  // namespace detail
+}  // namespace strong
+
+/**
+ * @brief Split block bloom filter of StrongTypes to rule out absent keys
+ * cheaply. Each key maps to one 32 byte block, which never crosses a cache
+ * line, and sets one bit in each of its 8 words, with AVX2 a lookup is a
+ * multiply, a shift and a test of one register. No false negatives, inserts
+ * are not thread safe
+ * @tparam Key StrongType, the config needs hash
+ */
+template <isStrongFilterKey Key>
+class StrongBloomFilter {
+  struct alignas(32) Block {
+    std::array<std::uint32_t, 8> words;
+  };
+
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Creates an empty filter
+   * @param expectedKeys number of keys the rate is met for
+   * @param falsePositiveRate target rate of false positives
+   * @throw std::invalid_argument if the rate isn't in (0, 1)
+   */
+  explicit StrongBloomFilter(size_type expectedKeys,
+                             double falsePositiveRate = 0.01) {
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+      throw std::invalid_argument(
+          "StrongBloomFilter: false positive rate not in (0, 1)");
+    }
+    double bitsPerKey = 4.0;
+    while (bitsPerKey < 64.0 && strong::detail::blockBloomFalsePositiveRate(
+                                    bitsPerKey) > falsePositiveRate) {
+      bitsPerKey += 0.25;
+    }
+    const auto bits =
+        static_cast<double>(std::max<size_type>(expectedKeys, 1)) * bitsPerKey;
+    const auto blockCount = static_cast<size_type>(std::ceil(bits / 256.0));
+    if (blockCount > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::length_error("StrongBloomFilter: too many keys");
+    }
+    blocks.resize(blockCount);
+  }
+
+  void insert(const Key& key) noexcept {
+    const auto hash = strong::detail::filterHash(key);
+    auto& block = blocks[blockIndex(hash)];
+#if defined(STRONGTYPES_AVX2)
+    auto* data = reinterpret_cast<__m256i*>(block.words.data());
+    _mm256_store_si256(data, _mm256_or_si256(_mm256_load_si256(data),
+                                             pattern(hash)));
+#else
+    const auto key32 = static_cast<std::uint32_t>(hash);
+    for (std::size_t i = 0; i < 8; ++i) {
+      block.words[i] |= bit(key32, i);
+    }
+#endif
+    ++count;
+  }
+  /**
+   * @brief If the key may have been inserted, false positives happen at
+   * about the configured rate
+   */
+  [[nodiscard]] auto contains(const Key& key) const noexcept -> bool {
+    return containsHash(strong::detail::filterHash(key));
+  }
+  /**
+   * @brief contains for every key, key i is bit i % 64 of word i / 64. The
+   * blocks of the next keys are prefetched while the current ones are tested
+   * @param keys keys to look up
+   * @param mask output, needs (keys.size() + 63) / 64 words
+   */
+  void contains(std::span<const Key> keys, std::span<std::uint64_t> mask) const
+      noexcept {
+    for (std::size_t i = 0; i < keys.size(); i += 64) {
+      const auto end = std::min(keys.size(), i + 64);
+      const auto n = end - i;
+      std::array<std::uint64_t, 64> hashes;
+      for (std::size_t j = 0; j < n; ++j) {
+        hashes[j] = strong::detail::filterHash(keys[i + j]);
+        if (j < strong::detail::prefetchDistance) {
+          strong::detail::prefetch(&blocks[blockIndex(hashes[j])]);
+        }
+      }
+      std::uint64_t word = 0;
+      for (std::size_t j = 0; j < n; ++j) {
+        if (j + strong::detail::prefetchDistance < n) {
+          strong::detail::prefetch(&blocks[blockIndex(
+              hashes[j + strong::detail::prefetchDistance])]);
+        }
+        word |= static_cast<std::uint64_t>(containsHash(hashes[j])) << j;
+      }
+      mask[i / 64] = word;
+    }
+  }
+  /**
+   * @brief contains for every key
+   * @return bitmask, key i is bit i % 64 of word i / 64
+   */
+  [[nodiscard]] auto contains(std::span<const Key> keys) const
+      -> std::vector<std::uint64_t> {
+    std::vector<std::uint64_t> mask((keys.size() + 63) / 64);
+    contains(keys, std::span{mask});
+    return mask;
+  }
+
+  /**
+   * @brief Number of inserts
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type { return count; }
+  [[nodiscard]] auto bitCount() const noexcept -> size_type {
+    return blocks.size() * 256;
+  }
+  /**
+   * @brief Expected false positive rate for the keys inserted so far
+   */
+  [[nodiscard]] auto falsePositiveRate() const -> double {
+    if (count == 0) {
+      return 0.0;
+    }
+    return strong::detail::blockBloomFalsePositiveRate(
+        static_cast<double>(bitCount()) / static_cast<double>(count));
+  }
+  void clear() noexcept {
+    std::fill(blocks.begin(), blocks.end(), Block{});
+    count = 0;
+  }
+
+  /**
+   * @brief Bytes of the filter to store or send, readable by deserialize of
+   * a build with the same config and std::hash of the underlying type
+   */
+  [[nodiscard]] auto serialize() const -> std::vector<std::byte> {
+    strong::FilterHeader header;
+    header.fingerprint =
+        strong::configFingerprint<typename Key::config_type>();
+    header.kind = 0;
+    header.words = blocks.size();
+    header.count = count;
+    return strong::detail::writeFilter(header, std::span<const Block>{blocks});
+  }
+  /**
+   * @brief Filter of serialize
+   * @throw std::invalid_argument if the buffer is no bloom filter of Key
+   */
+  [[nodiscard]] static auto deserialize(std::span<const std::byte> bytes)
+      -> StrongBloomFilter {
+    const auto header =
+        strong::detail::readFilterHeader<Key, Block>(bytes, 0);
+    StrongBloomFilter filter;
+    filter.blocks.resize(static_cast<size_type>(header.words));
+    std::memcpy(filter.blocks.data(), bytes.data() + sizeof(header),
+                filter.blocks.size() * sizeof(Block));
+    filter.count = static_cast<size_type>(header.count);
+    return filter;
+  }
+
+ private:
+  StrongBloomFilter() = default;
+
+  // odd constants, each selects the bit of one word
+  static constexpr std::array<std::uint32_t, 8> salts{
+      0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+      0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+
+  // the high half of the hash selects the block, the low half the bits
+  [[nodiscard]] auto blockIndex(std::uint64_t hash) const noexcept
+      -> size_type {
+    return static_cast<size_type>(((hash >> 32) * blocks.size()) >> 32);
+  }
+  [[nodiscard]] static constexpr auto bit(std::uint32_t key32,
+                                          std::size_t word) noexcept
+      -> std::uint32_t {
+    return std::uint32_t{1} << ((key32 * salts[word]) >> 27);
+  }
+#if defined(STRONGTYPES_AVX2)
+  [[nodiscard]] static auto pattern(std::uint64_t hash) noexcept -> __m256i {
+    const auto products = _mm256_mullo_epi32(
+        _mm256_set1_epi32(static_cast<std::int32_t>(hash)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salts.data())));
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1),
+                             _mm256_srli_epi32(products, 27));
+  }
+#endif
+  [[nodiscard]] auto containsHash(std::uint64_t hash) const noexcept -> bool {
+    const auto& block = blocks[blockIndex(hash)];
+#if defined(STRONGTYPES_AVX2)
+    return _mm256_testc_si256(
+               _mm256_load_si256(
+                   reinterpret_cast<const __m256i*>(block.words.data())),
+               pattern(hash)) != 0;
+#else
+    const auto key32 = static_cast<std::uint32_t>(hash);
+    std::uint32_t missing = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+      missing |= bit(key32, i) & ~block.words[i];
+    }
+    return missing == 0;
+#endif
+  }
+  std::vector<Block> blocks;
+  size_type count = 0;
+};
+
+/**
+ * @brief Cuckoo filter of StrongTypes: a fingerprint of every key in one of
+ * two buckets of a 64 bit word. Unlike a bloom filter keys can be erased.
+ * A lookup tests both words for the fingerprint 64 bits at a time (SWAR),
+ * without a branch. Inserts and erases are not thread safe
+ * @tparam Key StrongType, the config needs hash
+ * @tparam FingerprintBits 8, 16 or 32, a bucket holds 64 / FingerprintBits
+ * fingerprints. More bits lower the false positive rate
+ */
+template <isStrongFilterKey Key, std::size_t FingerprintBits = 16>
+  requires(FingerprintBits == 8 || FingerprintBits == 16 ||
+           FingerprintBits == 32)
+class StrongCuckooFilter {
+  static constexpr std::size_t slotsPerBucket = 64 / FingerprintBits;
+  static constexpr std::uint64_t fingerprintMask =
+      (std::uint64_t{1} << FingerprintBits) - 1;
+  // the lowest bit of every slot
+  static constexpr std::uint64_t lowBits =
+      std::numeric_limits<std::uint64_t>::max() / fingerprintMask;
+  static constexpr std::uint64_t highBits = lowBits << (FingerprintBits - 1);
+  static constexpr std::size_t maxKicks = 500;
+
+  // the buckets a lookup compares with
+  struct Probe {
+    std::size_t index;
+    std::size_t other;
+    std::uint64_t fingerprint;
+  };
+
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Upper bound of the false positive rate: a lookup compares with
+   * two buckets of fingerprints, 0 marks a free slot
+   */
+  static constexpr double false_positive_rate =
+      2.0 * slotsPerBucket / static_cast<double>(fingerprintMask);
+
+  /**
+   * @brief Creates an empty filter
+   * @param expectedKeys number of keys, the buckets are sized for a load
+   * which inserts reach with few relocations, rounded up to a power of two
+   */
+  explicit StrongCuckooFilter(size_type expectedKeys) {
+    const double maxLoad = slotsPerBucket == 2 ? 0.8 : 0.9;
+    const auto needed = static_cast<size_type>(std::ceil(
+        static_cast<double>(std::max<size_type>(expectedKeys, 1)) /
+        (slotsPerBucket * maxLoad)));
+    buckets.resize(std::bit_ceil(needed));
+  }
+
+  /**
+   * @brief Inserts the key, a key inserted twice has to be erased twice
+   * @return false if the filter is full, the key is then not inserted
+   */
+  auto insert(const Key& key) -> bool {
+    if (victimFingerprint != 0) {
+      return false;
+    }
+    const auto hash = strong::detail::filterHash(key);
+    auto fingerprint = fingerprintOf(hash);
+    auto index = indexOf(hash);
+    if (place(index, fingerprint) ||
+        place(alternate(index, fingerprint), fingerprint)) {
+      ++count;
+      return true;
+    }
+    // relocate fingerprints to their other bucket
+    for (std::size_t kick = 0; kick < maxKicks; ++kick) {
+      random ^= random << 13;
+      random ^= random >> 7;
+      random ^= random << 17;
+      const auto shift = (random % slotsPerBucket) * FingerprintBits;
+      const auto evicted = (buckets[index] >> shift) & fingerprintMask;
+      buckets[index] = (buckets[index] & ~(fingerprintMask << shift)) |
+                       (fingerprint << shift);
+      fingerprint = evicted;
+      index = alternate(index, fingerprint);
+      if (place(index, fingerprint)) {
+        ++count;
+        return true;
+      }
+    }
+    // the key is in the table, the last evicted fingerprint is kept aside
+    victimIndex = index;
+    victimFingerprint = fingerprint;
+    ++count;
+    return true;
+  }
+  /**
+   * @brief If the key may have been inserted, false positives happen at most
+   * at false_positive_rate
+   */
+  [[nodiscard]] auto contains(const Key& key) const noexcept -> bool {
+    return containsProbe(probeOf(key));
+  }
+  /**
+   * @brief contains for every key, key i is bit i % 64 of word i / 64. The
+   * lookups of 64 keys are independent, so their bucket loads overlap
+   * @param keys keys to look up
+   * @param mask output, needs (keys.size() + 63) / 64 words
+   */
+  void contains(std::span<const Key> keys, std::span<std::uint64_t> mask) const
+      noexcept {
+    for (std::size_t i = 0; i < keys.size(); i += 64) {
+      const auto block = keys.subspan(i, std::min<std::size_t>(
+                                             64, keys.size() - i));
+      // a plain loop the compiler vectorizes, e.g. with gathers
+      std::array<std::uint8_t, 64> hits{};
+      for (std::size_t j = 0; j < block.size(); ++j) {
+        hits[j] = containsProbe(probeOf(block[j])) ? 1 : 0;
+      }
+      mask[i / 64] = strong::detail::packBits(hits);
+    }
+  }
+  /**
+   * @brief contains for every key
+   * @return bitmask, key i is bit i % 64 of word i / 64
+   */
+  [[nodiscard]] auto contains(std::span<const Key> keys) const
+      -> std::vector<std::uint64_t> {
+    std::vector<std::uint64_t> mask((keys.size() + 63) / 64);
+    contains(keys, std::span{mask});
+    return mask;
+  }
+  /**
+   * @brief Erases a key, which must have been inserted. Erasing any other
+   * key may erase the fingerprint of an inserted one
+   * @return false if the fingerprint of the key isn't in the filter
+   */
+  auto erase(const Key& key) noexcept -> bool {
+    const auto hash = strong::detail::filterHash(key);
+    const auto fingerprint = fingerprintOf(hash);
+    const auto index = indexOf(hash);
+    if (victimFingerprint == fingerprint &&
+        (victimIndex == index ||
+         victimIndex == alternate(index, fingerprint))) {
+      victimFingerprint = 0;
+      --count;
+      return true;
+    }
+    if (!remove(index, fingerprint) &&
+        !remove(alternate(index, fingerprint), fingerprint)) {
+      return false;
+    }
+    --count;
+    // room for the victim again
+    if (victimFingerprint != 0 &&
+        (place(victimIndex, victimFingerprint) ||
+         place(alternate(victimIndex, victimFingerprint),
+               victimFingerprint))) {
+      victimFingerprint = 0;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Number of keys
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type { return count; }
+  [[nodiscard]] auto bitCount() const noexcept -> size_type {
+    return buckets.size() * 64;
+  }
+  void clear() noexcept {
+    std::fill(buckets.begin(), buckets.end(), std::uint64_t{0});
+    victimFingerprint = 0;
+    count = 0;
+  }
+
+  /**
+   * @brief Bytes of the filter to store or send, readable by deserialize of
+   * a build with the same config and std::hash of the underlying type
+   */
+  [[nodiscard]] auto serialize() const -> std::vector<std::byte> {
+    strong::FilterHeader header;
+    header.fingerprint =
+        strong::configFingerprint<typename Key::config_type>();
+    header.kind = FingerprintBits;
+    header.words = buckets.size();
+    header.count = count;
+    header.victimIndex = victimIndex;
+    header.victimFingerprint = victimFingerprint;
+    return strong::detail::writeFilter(header,
+                                       std::span<const std::uint64_t>{buckets});
+  }
+  /**
+   * @brief Filter of serialize
+   * @throw std::invalid_argument if the buffer is no cuckoo filter of Key
+   * with FingerprintBits
+   */
+  [[nodiscard]] static auto deserialize(std::span<const std::byte> bytes)
+      -> StrongCuckooFilter {
+    const auto header = strong::detail::readFilterHeader<Key, std::uint64_t>(
+        bytes, FingerprintBits);
+    if (!std::has_single_bit(header.words) ||
+        header.victimIndex >= header.words ||
+        header.victimFingerprint > fingerprintMask) {
+      throw std::invalid_argument("StrongFilter: invalid cuckoo filter");
+    }
+    StrongCuckooFilter filter{0};
+    filter.buckets.resize(static_cast<size_type>(header.words));
+    std::memcpy(filter.buckets.data(), bytes.data() + sizeof(header),
+                filter.buckets.size() * sizeof(std::uint64_t));
+    filter.count = static_cast<size_type>(header.count);
+    filter.victimIndex = static_cast<size_type>(header.victimIndex);
+    filter.victimFingerprint = header.victimFingerprint;
+    return filter;
+  }
+
+ private:
+  [[nodiscard]] auto indexOf(std::uint64_t hash) const noexcept -> size_type {
+    return static_cast<size_type>(hash) & (buckets.size() - 1);
+  }
+  [[nodiscard]] static constexpr auto fingerprintOf(std::uint64_t hash) noexcept
+      -> std::uint64_t {
+    const auto fingerprint = (hash >> 32) & fingerprintMask;
+    return fingerprint == 0 ? 1 : fingerprint;
+  }
+  // the other bucket of a fingerprint, either bucket leads to the other one
+  [[nodiscard]] auto alternate(size_type index,
+                               std::uint64_t fingerprint) const noexcept
+      -> size_type {
+    return (index ^ static_cast<size_type>(strong::mixHash(fingerprint))) &
+           (buckets.size() - 1);
+  }
+  // slots of a bucket equal to value as their high bit
+  [[nodiscard]] static constexpr auto matches(std::uint64_t bucket,
+                                              std::uint64_t value) noexcept
+      -> std::uint64_t {
+    const auto difference = bucket ^ (value * lowBits);
+    return (difference - lowBits) & ~difference & highBits;
+  }
+  [[nodiscard]] auto probeOf(const Key& key) const noexcept -> Probe {
+    const auto hash = strong::detail::filterHash(key);
+    const auto fingerprint = fingerprintOf(hash);
+    const auto index = indexOf(hash);
+    return {index, alternate(index, fingerprint), fingerprint};
+  }
+  [[nodiscard]] auto containsProbe(const Probe& probe) const noexcept -> bool {
+    return (matches(buckets[probe.index], probe.fingerprint) |
+            matches(buckets[probe.other], probe.fingerprint) |
+            static_cast<std::uint64_t>(
+                victimFingerprint == probe.fingerprint &&
+                (victimIndex == probe.index || victimIndex == probe.other))) !=
+           0;
+  }
+  // puts the fingerprint into a free slot of the bucket
+  auto place(size_type index, std::uint64_t fingerprint) noexcept -> bool {
+    const auto free = matches(buckets[index], 0);
+    if (free == 0) {
+      return false;
+    }
+    // the lowest match is exact, higher ones may be borrows
+    const auto shift = static_cast<std::size_t>(std::countr_zero(free)) /
+                       FingerprintBits * FingerprintBits;
+    buckets[index] |= fingerprint << shift;
+    return true;
+  }
+  auto remove(size_type index, std::uint64_t fingerprint) noexcept -> bool {
+    const auto found = matches(buckets[index], fingerprint);
+    if (found == 0) {
+      return false;
+    }
+    const auto shift = static_cast<std::size_t>(std::countr_zero(found)) /
+                       FingerprintBits * FingerprintBits;
+    buckets[index] &= ~(fingerprintMask << shift);
+    return true;
+  }
+
+  std::vector<std::uint64_t> buckets;
+  size_type count = 0;
+  size_type victimIndex = 0;
+  // 0 if no fingerprint is kept aside
+  std::uint64_t victimFingerprint = 0;
+  std::uint64_t random = 0x9e3779b97f4a7c15;
+};
@@ -0,0 +1,147 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace strong {
+/**
+ * @brief String of at most N characters stored inline with a length byte, so
+ * it never allocates and is trivially copyable. Unused characters are zero,
+ * which makes equality a comparison of the whole object. Use it as
+ * underlyingType of a StrongType (e.g. StrongFixedString<12>), get() then
+ * converts to std::string_view
+ * @tparam N capacity in characters, at most 255
+ */
+template <std::size_t N>
+  requires(N > 0 && N <= 255)
+class FixedString {
+ public:
+  static constexpr std::size_t capacity = N;
+
+  constexpr FixedString() noexcept = default;
+  /**
+   * @brief Constructs from a string literal, a literal longer than N doesn't
+   * compile
+   * @tparam M size of the literal including its terminating zero
+   */
+  template <std::size_t M>
+    requires(M - 1 <= N)
+  consteval FixedString(const char (&literal)[M]) noexcept {
+    assign(std::string_view{literal, M - 1});
+  }
+  /**
+   * @brief Constructs from a runtime string
+   * @param text at most N characters
+   * @throw std::length_error if the text is longer than N
+   */
+  constexpr explicit FixedString(std::string_view text) {
+    if (text.size() > N) {
+      throw std::length_error("FixedString: text exceeds the capacity");
+    }
+    assign(text);
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    return length;
+  }
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return length == 0;
+  }
+  [[nodiscard]] constexpr auto data() const noexcept -> const char* {
+    return chars.data();
+  }
+  [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+    return {chars.data(), length};
+  }
+  [[nodiscard]] constexpr operator std::string_view() const noexcept {
+    return view();
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+      const FixedString& lhs, const FixedString& rhs) noexcept -> bool {
+    if (std::is_constant_evaluated()) {
+      return lhs.view() == rhs.view();
+    }
+    // no padding and zeroed unused characters, a few word compares for
+    // small N
+    return std::memcmp(&lhs, &rhs, sizeof(FixedString)) == 0;
+  }
+  /**
+   * @brief Lexicographic order like std::string
+   */
+  [[nodiscard]] friend constexpr auto operator<=>(
+      const FixedString& lhs, const FixedString& rhs) noexcept
+      -> std::strong_ordering {
+    // the zeroed tails compare all N characters at once, equal characters
+    // are then ordered by length (e.g. an embedded '\0')
+    const int order =
+        std::char_traits<char>::compare(lhs.chars.data(), rhs.chars.data(), N);
+    if (order != 0) {
+      return order <=> 0;
+    }
+    return lhs.length <=> rhs.length;
+  }
+
+ private:
+  constexpr void assign(std::string_view text) noexcept {
+    for (std::size_t i = 0; i < text.size(); ++i) {
+      chars[i] = text[i];
+    }
+    length = static_cast<std::uint8_t>(text.size());
+  }
+
+  std::array<char, N> chars{};
+  std::uint8_t length = 0;
+};
+}  // namespace strong
+
+namespace std {
+/**
+ * @brief Hash of the characters, equal to the hash of their string_view
+ */
+template <std::size_t N>
+struct hash<strong::FixedString<N>> {
+  [[nodiscard]] auto operator()(const strong::FixedString<N>& text) const
+      noexcept -> std::size_t {
+    return std::hash<std::string_view>{}(text.view());
+  }
+};
+}  // namespace std
+
+namespace strong {
+/**
+ * @brief Config of StrongFixedString, ordered and hashable
+ * @tparam N capacity in characters
+ */
+template <std::size_t N>
+struct FixedStringConfig {
+  using underlyingType = FixedString<N>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+}  // namespace strong
+
+/**
+ * @brief StrongType over an inline string of at most N characters
+ */
+template <std::size_t N>
+using StrongFixedString = StrongType<strong::FixedStringConfig<N>>;
@@ -0,0 +1,294 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+/**
+ * @brief Concept if the optional format flag of a config is set, enables the
+ * std::formatter specialization. An optional
+ * static constexpr std::string_view formatPrefix = "...";
+ * is written in front of the value, e.g. "db#" for db#42
+ */
+template <typename config>
+concept isFormatEnabled = requires() {
+  { config::format } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::format);
+
+namespace strong {
+namespace detail {
+template <typename config>
+[[nodiscard]] constexpr auto formatPrefix() noexcept -> std::string_view {
+  if constexpr (requires() {
+                  { config::formatPrefix } -> std::convertible_to<
+                                               std::string_view>;
+                }) {
+    return config::formatPrefix;
+  } else {
+    return {};
+  }
+}
+
+/**
+ * @brief If a parsed value can become a T, i.e. passes the validator and fits
+ * the storage type
+ */
+template <typename T>
+[[nodiscard]] constexpr auto isAcceptable(const typename T::type& value)
+    -> bool {
+  using config = typename T::config_type;
+  if constexpr (isValidationEnabled<config>) {
+    if (!config::validator::isValid(value)) {
+      return false;
+    }
+  }
+  if constexpr (isCompressionEnabled<config>) {
+    return std::in_range<typename T::storage_type>(value);
+  }
+  return true;
+}
+}  // namespace detail
+
+/**
+ * @brief Writes the underlying value like std::to_chars, without allocating
+ * @param first begin of the output
+ * @param last end of the output
+ * @param value StrongType to write
+ * @param args e.g. the base or the floating point format
+ * @return end of the written characters or std::errc::value_too_large
+ */
+template <isStrongType T, typename... Args>
+  requires requires(char* out, const typename T::type& value, Args... args) {
+    std::to_chars(out, out, value, args...);
+  }
+auto to_chars(char* first, char* last, const T& value, Args... args)
+    -> std::to_chars_result {
+  return std::to_chars(first, last, value.get(), args...);
+}
+
+/**
+ * @brief Parses the underlying value like std::from_chars. The StrongType is
+ * only assigned if the whole value is acceptable
+ * @param first begin of the text
+ * @param last end of the text
+ * @param value StrongType to assign
+ * @param args e.g. the base or the floating point format
+ * @return end of the parsed characters, std::errc::invalid_argument if there
+ * is no number and std::errc::result_out_of_range if it doesn't fit the
+ * underlying type, is rejected by the validator or exceeds the storage type
+ */
+template <isStrongType T, typename... Args>
+  requires requires(const char* in, typename T::type& parsed, Args... args) {
+    std::from_chars(in, in, parsed, args...);
+  }
+auto from_chars(const char* first, const char* last, T& value, Args... args)
+    -> std::from_chars_result {
+  typename T::type parsed{};
+  auto result = std::from_chars(first, last, parsed, args...);
+  if (result.ec != std::errc{}) {
+    return result;
+  }
+  if (!detail::isAcceptable<T>(parsed)) {
+    result.ec = std::errc::result_out_of_range;
+    return result;
+  }
+  value = T{unchecked, parsed};
+  return result;
+}
+
+namespace detail {
+inline constexpr std::uint64_t zeroChars = 0x3030303030303030;
+
+/**
+ * @brief Mask with the high bit of every byte of a little endian word, which
+ * is no decimal digit
+ */
+[[nodiscard]] constexpr auto nonDigitBytes(std::uint64_t chars) noexcept
+    -> std::uint64_t {
+  // '0'..'9' become 0..9, adding 0x76 sets the high bit of larger bytes
+  // without a carry into the next byte
+  const auto values = chars ^ zeroChars;
+  return (((values & 0x7F7F7F7F7F7F7F7F) + 0x7676767676767676) | values) &
+         0x8080808080808080;
+}
+/**
+ * @brief Value of 8 decimal digits of a little endian word, the first
+ * character in the lowest byte. 3 multiplications instead of 8 steps
+ */
+[[nodiscard]] constexpr auto parseEightDigits(std::uint64_t chars) noexcept
+    -> std::uint32_t {
+  chars -= zeroChars;
+  chars = chars * 10 + (chars >> 8);  // pairs of digits in every other byte
+  chars = ((chars & 0x000000FF000000FF) * (100 + (1000000ULL << 32)) +
+           ((chars >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32))) >>
+          32;
+  return static_cast<std::uint32_t>(chars);
+}
+
+inline constexpr std::uint64_t powersOf10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+/**
+ * @brief Parses an integer of decimal digits with an optional '-' 8
+ * characters at a time and finds its end on the way. Only integers of at most
+ * digits10 digits, which can't overflow, and only while 8 characters can be
+ * loaded from the buffer
+ * @param first begin of the integer
+ * @param end end of the readable buffer
+ * @param value parsed value
+ * @return end of the digits or nullptr if the scalar path is needed
+ */
+template <typename type>
+[[nodiscard]] auto parseDigitsSwar(const char* first, const char* end,
+                                   type& value) noexcept -> const char* {
+  constexpr auto maxDigits =
+      static_cast<std::size_t>(std::numeric_limits<type>::digits10);
+  bool negative = false;
+  if constexpr (std::is_signed_v<type>) {
+    if (first != end && *first == '-') {
+      negative = true;
+      ++first;
+    }
+  }
+  std::uint64_t result = 0;
+  std::size_t digits = 0;
+  while (true) {
+    if (end - first < 8) {
+      return nullptr;
+    }
+    std::uint64_t chars;
+    std::memcpy(&chars, first, 8);
+    const auto nonDigits = nonDigitBytes(chars);
+    const auto count =
+        nonDigits == 0 ? std::size_t{8}
+                       : static_cast<std::size_t>(std::countr_zero(nonDigits)) /
+                             8;
+    digits += count;
+    if (digits > maxDigits) {
+      return nullptr;
+    }
+    if (count == 8) {
+      result = result * powersOf10[8] + parseEightDigits(chars);
+      first += 8;
+      continue;
+    }
+    if (count != 0) {
+      // the digits at the top of the word behind '0' padding
+      chars = (chars << (8 * (8 - count))) | (zeroChars >> (8 * count));
+      result = result * powersOf10[count] + parseEightDigits(chars);
+      first += count;
+    }
+    break;
+  }
+  if (digits == 0) {
+    return nullptr;
+  }
+  using unsignedType = std::make_unsigned_t<type>;
+  const auto magnitude = static_cast<unsignedType>(result);
+  value = static_cast<type>(negative ? unsignedType{0} - magnitude
+                                     : magnitude);
+  return first;
+}
+
+[[noreturn]] inline void throwInvalidField(std::size_t offset) {
+  throw std::invalid_argument("parse_column: invalid value at offset " +
+                              std::to_string(offset));
+}
+}  // namespace detail
+
+/**
+ * @brief Parses a column of delimiter separated values, e.g. one per line of
+ * a file. Integral values are parsed 8 digits at a time, other values via
+ * std::from_chars, neither depends on the locale. A trailing delimiter is
+ * ignored, whitespace is not skipped
+ * @tparam T StrongType whose underlying type std::from_chars can parse
+ * @param buffer text of the column
+ * @param delim separator of the values
+ * @return the parsed values
+ * @throw std::invalid_argument with the offset of the first value, which is
+ * no number, out of range or rejected by the config
+ */
+template <isStrongType T>
+  requires requires(const char* in, typename T::type& parsed) {
+    std::from_chars(in, in, parsed);
+  }
+[[nodiscard]] auto parse_column(std::string_view buffer, char delim)
+    -> std::vector<T> {
+  using type = typename T::type;
+  std::vector<T> values;
+  if (buffer.empty()) {
+    return values;
+  }
+  values.reserve(static_cast<std::size_t>(
+                     std::count(buffer.begin(), buffer.end(), delim)) +
+                 1);
+  const char* const begin = buffer.data();
+  const char* const end = begin + buffer.size();
+  for (const char* first = begin; first != end;) {
+    type parsed{};
+    const char* last = nullptr;
+    if constexpr (std::is_integral_v<type> && !std::is_same_v<type, bool> &&
+                  std::endian::native == std::endian::little) {
+      last = detail::parseDigitsSwar(first, end, parsed);
+      if (last != nullptr && last != end && *last != delim) {
+        last = nullptr;  // let the scalar path report the value
+      }
+    }
+    if (last == nullptr) {
+      const auto* found = static_cast<const char*>(
+          std::memchr(first, delim, static_cast<std::size_t>(end - first)));
+      last = found == nullptr ? end : found;
+      const auto result = std::from_chars(first, last, parsed);
+      if (result.ec != std::errc{} || result.ptr != last) {
+        detail::throwInvalidField(static_cast<std::size_t>(first - begin));
+      }
+    }
+    if (!detail::isAcceptable<T>(parsed)) {
+      detail::throwInvalidField(static_cast<std::size_t>(first - begin));
+    }
+    values.emplace_back(unchecked, parsed);
+    first = last == end ? end : last + 1;
+  }
+  return values;
+}
+}  // namespace strong
+
+#if defined(__cpp_lib_format)
+namespace std {
+/**
+ * @brief Formats a StrongType like its underlying value, including the format
+ * spec, after the formatPrefix of its config. Needs the format flag
+ */
+template <isStrongTypeConfig config>
+  requires isFormatEnabled<config>
+struct formatter<StrongType<config>, char>
+    : formatter<typename StrongType<config>::type, char> {
+  template <typename context>
+  auto format(const StrongType<config>& value, context& ctx) const
+      -> decltype(ctx.out()) {
+    ctx.advance_to(std::ranges::copy(strong::detail::formatPrefix<config>(),
+                                     ctx.out())
+                       .out);
+    return formatter<typename StrongType<config>::type, char>::format(
+        value.get(), ctx);
+  }
+};
+}  // namespace std
+#endif
@@ -0,0 +1,636 @@
+#pragma once
+#include <StrongTypes/StrongSimd.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Concept of a StrongType which can be used as key of a StrongHashMap
+ * or StrongHashSet, the config needs to enable hashing and equality
+ */
+template <typename T>
+concept isStrongHashKey = isStrongType<T> &&
+                          isHashEnabled<typename T::config_type> &&
+                          T::config_type::equal &&
+                          isEqualComparable<typename T::type>;
+
+namespace strong::detail {
+// Control bytes: a full slot stores the lower 7 bits of its hash, empty and
+// deleted slots have the sign bit set
+inline constexpr std::int8_t ctrlEmpty = -128;
+inline constexpr std::int8_t ctrlDeleted = -2;
+inline constexpr std::size_t groupWidth = 16;
+
+/**
+ * @brief 16 control bytes which are probed at once
+ */
+class Group {
+ public:
+  explicit Group(const std::int8_t* ctrl) noexcept {
+#ifdef STRONGTYPES_SSE2
+    bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    std::memcpy(bytes, ctrl, groupWidth);
+#endif
+  }
+  /**
+   * @brief Slots whose control byte equals h2
+   * @param h2 lower 7 bits of the hash
+   * @return bitmask, one bit per slot
+   */
+  [[nodiscard]] auto match(std::int8_t h2) const noexcept -> std::uint32_t {
+#ifdef STRONGTYPES_SSE2
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes)));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < groupWidth; ++i) {
+      mask |= static_cast<std::uint32_t>(bytes[i] == h2) << i;
+    }
+    return mask;
+#endif
+  }
+  /**
+   * @brief Empty slots
+   * @return bitmask, one bit per slot
+   */
+  [[nodiscard]] auto matchEmpty() const noexcept -> std::uint32_t {
+    return match(ctrlEmpty);
+  }
+  /**
+   * @brief Empty or deleted slots, the only control bytes with the sign bit
+   * @return bitmask, one bit per slot
+   */
+  [[nodiscard]] auto matchEmptyOrDeleted() const noexcept -> std::uint32_t {
+#ifdef STRONGTYPES_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < groupWidth; ++i) {
+      mask |= static_cast<std::uint32_t>(bytes[i] < 0) << i;
+    }
+    return mask;
+#endif
+  }
+
+ private:
+#ifdef STRONGTYPES_SSE2
+  __m128i bytes;
+#else
+  std::int8_t bytes[groupWidth];
+#endif
+};
+
+/**
+ * @brief Open addressing hash table with SIMD probed control bytes (swiss
+ * table layout). Key and value share a slot, so a successful lookup touches
+ * one control byte group and one slot.
+ * @tparam Key StrongType used as key
+ * @tparam Mapped mapped type, void for a set
+ */
+template <isStrongHashKey Key, typename Mapped>
+class FlatTable {
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using underlying_type = typename Key::type;
+  static constexpr bool isMap = !std::is_void_v<Mapped>;
+  using mapped_storage = std::conditional_t<isMap, Mapped, char>;
+
+  /**
+   * @brief Storage of one element
+   */
+  struct MapSlot {
+    template <typename K, typename... Args>
+    explicit MapSlot(K&& key, Args&&... args)
+        : key(std::forward<K>(key)), value(std::forward<Args>(args)...) {}
+    Key key;
+    mapped_storage value;
+  };
+  struct SetSlot {
+    template <typename K>
+    explicit SetSlot(K&& key) : key(std::forward<K>(key)) {}
+    Key key;
+  };
+  using slot_type = std::conditional_t<isMap, MapSlot, SetSlot>;
+
+  /**
+   * @brief Forward iterator over all full slots
+   * @tparam isConst const iterator
+   */
+  template <bool isConst>
+  class Iterator {
+   public:
+    using table_type = std::conditional_t<isConst, const FlatTable, FlatTable>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using mapped_ref =
+        std::conditional_t<isConst, const mapped_storage&, mapped_storage&>;
+    using reference = std::conditional_t<
+        isMap, std::pair<const Key&, mapped_ref>, const Key&>;
+    using value_type = std::conditional_t<isMap, std::pair<Key, Mapped>, Key>;
+    struct pointer {
+      reference ref;
+      [[nodiscard]] auto operator->() noexcept -> reference* { return &ref; }
+    };
+
+    Iterator() = default;
+    Iterator(table_type* table, size_type index) noexcept
+        : table{table}, index{index} {
+      skipEmpty();
+    }
+    /**
+     * @brief Conversion of a mutable to a const iterator
+     */
+    template <bool otherConst>
+      requires(isConst && !otherConst)
+    Iterator(const Iterator<otherConst>& other) noexcept
+        : table{other.table}, index{other.index} {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+      if constexpr (isMap) {
+        return reference{table->slots[index].key, table->slots[index].value};
+      } else {
+        return table->slots[index].key;
+      }
+    }
+    [[nodiscard]] auto operator->() const noexcept {
+      if constexpr (isMap) {
+        return pointer{**this};
+      } else {
+        return &table->slots[index].key;
+      }
+    }
+    auto operator++() noexcept -> Iterator& {
+      ++index;
+      skipEmpty();
+      return *this;
+    }
+    auto operator++(int) noexcept -> Iterator {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+    [[nodiscard]] auto operator==(const Iterator& rhs) const noexcept -> bool {
+      return index == rhs.index;
+    }
+
+   private:
+    friend class FlatTable;
+    friend class Iterator<!isConst>;
+
+    void skipEmpty() noexcept {
+      while (index < table->capacity_ && table->ctrl[index] < 0) {
+        ++index;
+      }
+    }
+
+    table_type* table = nullptr;
+    size_type index = 0;
+  };
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatTable() noexcept = default;
+  FlatTable(const FlatTable& other) : FlatTable{} {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (other.ctrl[i] >= 0) {
+        if constexpr (isMap) {
+          emplaceNew(other.slots[i].key, other.slots[i].value);
+        } else {
+          emplaceNew(other.slots[i].key);
+        }
+      }
+    }
+  }
+  FlatTable(FlatTable&& other) noexcept
+      : ctrl{std::exchange(other.ctrl, nullptr)},
+        slots{std::exchange(other.slots, nullptr)},
+        capacity_{std::exchange(other.capacity_, 0)},
+        size_{std::exchange(other.size_, 0)},
+        growthLeft{std::exchange(other.growthLeft, 0)} {}
+  auto operator=(const FlatTable& other) -> FlatTable& {
+    if (this != &other) {
+      auto copy = other;
+      swap(copy);
+    }
+    return *this;
+  }
+  auto operator=(FlatTable&& other) noexcept -> FlatTable& {
+    auto moved = std::move(other);
+    swap(moved);
+    return *this;
+  }
+  ~FlatTable() { release(); }
+
+  void swap(FlatTable& other) noexcept {
+    std::swap(ctrl, other.ctrl);
+    std::swap(slots, other.slots);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growthLeft, other.growthLeft);
+  }
+
+  [[nodiscard]] auto begin() noexcept -> iterator { return {this, 0}; }
+  [[nodiscard]] auto end() noexcept -> iterator { return {this, capacity_}; }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return {this, 0};
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return {this, capacity_};
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return capacity_;
+  }
+
+  /**
+   * @brief Makes room for at least count elements without rehashing
+   * @param count number of elements
+   */
+  void reserve(size_type count) {
+    if (count > maxLoad(capacity_)) {
+      rehash(capacityFor(count));
+    }
+  }
+  /**
+   * @brief Removes all elements but keeps the memory
+   */
+  void clear() noexcept {
+    destroyAll();
+    if (capacity_ > 0) {
+      std::memset(ctrl, ctrlEmpty, capacity_);
+    }
+    size_ = 0;
+    growthLeft = maxLoad(capacity_);
+  }
+
+  [[nodiscard]] auto find(const Key& key) -> iterator {
+    return {this, findIndex(key.get())};
+  }
+  [[nodiscard]] auto find(const Key& key) const -> const_iterator {
+    return {this, findIndex(key.get())};
+  }
+  /**
+   * @brief Lookup via the underlying type, only available if the config allows
+   * the underlying type in operators
+   */
+  template <typename otherType>
+    requires std::is_same_v<underlying_type, otherType> &&
+             Key::config_type::allowUnderlyingTypeInOperator
+  [[nodiscard]] auto find(const otherType& key) -> iterator {
+    return {this, findIndex(key)};
+  }
+  template <typename otherType>
+    requires std::is_same_v<underlying_type, otherType> &&
+             Key::config_type::allowUnderlyingTypeInOperator
+  [[nodiscard]] auto find(const otherType& key) const -> const_iterator {
+    return {this, findIndex(key)};
+  }
+  [[nodiscard]] auto contains(const Key& key) const -> bool {
+    return findIndex(key.get()) != capacity_;
+  }
+  template <typename otherType>
+    requires std::is_same_v<underlying_type, otherType> &&
+             Key::config_type::allowUnderlyingTypeInOperator
+  [[nodiscard]] auto contains(const otherType& key) const -> bool {
+    return findIndex(key) != capacity_;
+  }
+  [[nodiscard]] auto count(const Key& key) const -> size_type {
+    return contains(key) ? 1 : 0;
+  }
+
+  /**
+   * @brief Removes the element with the given key
+   * @param key key to remove
+   * @return number of removed elements
+   */
+  auto erase(const Key& key) -> size_type {
+    const auto index = findIndex(key.get());
+    if (index == capacity_) {
+      return 0;
+    }
+    eraseIndex(index);
+    return 1;
+  }
+  /**
+   * @brief Removes the element at the given position
+   * @param pos position of the element
+   * @return position of the next element
+   */
+  auto erase(const_iterator pos) -> iterator {
+    eraseIndex(pos.index);
+    return {this, pos.index + 1};
+  }
+
+ protected:
+  /**
+   * @brief Inserts a new element if the key isn't present
+   * @param key key of the element
+   * @param ...args constructor arguments of the mapped value
+   * @return position of the element and if it has been inserted
+   */
+  template <typename K, typename... Args>
+  auto tryEmplace(K&& key, Args&&... args) -> std::pair<iterator, bool> {
+    const auto hash = strong::hashValue(std::as_const(key).get());
+    if (const auto index = findIndex(std::as_const(key).get(), hash);
+        index != capacity_) {
+      return {iterator{this, index}, false};
+    }
+    const auto index = emplaceHashed(hash, std::forward<K>(key),
+                                     std::forward<Args>(args)...);
+    return {iterator{this, index}, true};
+  }
+
+  [[nodiscard]] auto findIndex(const underlying_type& key) const -> size_type {
+    return findIndex(key, strong::hashValue(key));
+  }
+
+  [[nodiscard]] auto findIndex(const underlying_type& key,
+                               std::size_t hash) const -> size_type {
+    if (capacity_ == 0) {
+      return capacity_;
+    }
+    const auto groupMask = capacity_ / groupWidth - 1;
+    auto group = h1(hash) & groupMask;
+    for (size_type step = 1; step <= groupMask + 1; ++step) {
+      const Group probe{ctrl + group * groupWidth};
+      for (auto mask = probe.match(h2(hash)); mask != 0; mask &= mask - 1) {
+        const auto index =
+            group * groupWidth + static_cast<size_type>(std::countr_zero(mask));
+        if (slots[index].key.get() == key) {
+          return index;
+        }
+      }
+      if (probe.matchEmpty() != 0) {
+        break;
+      }
+      group = (group + step) & groupMask;
+    }
+    return capacity_;
+  }
+
+  /**
+   * @brief Access to the mapped value of a full slot
+   * @param index slot index
+   * @return mapped value
+   */
+  [[nodiscard]] auto mappedAt(size_type index) noexcept -> mapped_storage& {
+    return slots[index].value;
+  }
+  [[nodiscard]] auto mappedAt(size_type index) const noexcept
+      -> const mapped_storage& {
+    return slots[index].value;
+  }
+
+ private:
+  template <typename K, typename... Args>
+  auto emplaceNew(K&& key, Args&&... args) -> size_type {
+    const auto hash = strong::hashValue(std::as_const(key).get());
+    return emplaceHashed(hash, std::forward<K>(key),
+                         std::forward<Args>(args)...);
+  }
+
+  template <typename K, typename... Args>
+  auto emplaceHashed(std::size_t hash, K&& key, Args&&... args) -> size_type {
+    if (growthLeft == 0) {
+      rehash(size_ + 1 > maxLoad(capacity_) / 2 ? capacity_ * 2
+                                                : capacity_);
+    }
+    const auto index = findFree(hash);
+    std::construct_at(slots + index, std::forward<K>(key),
+                      std::forward<Args>(args)...);
+    if (ctrl[index] == ctrlEmpty) {
+      --growthLeft;
+    }
+    ctrl[index] = h2(hash);
+    ++size_;
+    return index;
+  }
+
+  [[nodiscard]] static constexpr auto h1(std::size_t hash) noexcept
+      -> size_type {
+    return hash >> 7;
+  }
+  [[nodiscard]] static constexpr auto h2(std::size_t hash) noexcept
+      -> std::int8_t {
+    return static_cast<std::int8_t>(hash & 0x7f);
+  }
+  [[nodiscard]] static constexpr auto maxLoad(size_type capacity) noexcept
+      -> size_type {
+    return capacity - capacity / 8;
+  }
+  [[nodiscard]] static constexpr auto capacityFor(size_type count) noexcept
+      -> size_type {
+    auto capacity = std::bit_ceil(count + count / 7 + 1);
+    return capacity < groupWidth ? groupWidth : capacity;
+  }
+
+  [[nodiscard]] auto findFree(std::size_t hash) const noexcept -> size_type {
+    const auto groupMask = capacity_ / groupWidth - 1;
+    auto group = h1(hash) & groupMask;
+    for (size_type step = 1;; ++step) {
+      const auto mask = Group{ctrl + group * groupWidth}.matchEmptyOrDeleted();
+      if (mask != 0) {
+        return group * groupWidth +
+               static_cast<size_type>(std::countr_zero(mask));
+      }
+      group = (group + step) & groupMask;
+    }
+  }
+
+  void eraseIndex(size_type index) noexcept {
+    std::destroy_at(slots + index);
+    --size_;
+    // A probe never continued past a group with an empty slot, so the slot can
+    // become empty again instead of leaving a tombstone
+    const auto groupStart = index - index % groupWidth;
+    if (Group{ctrl + groupStart}.matchEmpty() != 0) {
+      ctrl[index] = ctrlEmpty;
+      ++growthLeft;
+    } else {
+      ctrl[index] = ctrlDeleted;
+    }
+  }
+
+  void rehash(size_type newCapacity) {
+    if (newCapacity < groupWidth) {
+      newCapacity = groupWidth;
+    }
+    FlatTable table;
+    table.allocate(newCapacity);
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl[i] >= 0) {
+        const auto hash = strong::hashValue(slots[i].key.get());
+        const auto index = table.findFree(hash);
+        std::construct_at(table.slots + index, std::move(slots[i]));
+        table.ctrl[index] = h2(hash);
+        --table.growthLeft;
+        ++table.size_;
+      }
+    }
+    swap(table);
+  }
+
+  void allocate(size_type capacity) {
+    ctrl = static_cast<std::int8_t*>(
+        ::operator new(capacity, std::align_val_t{groupWidth}));
+    std::memset(ctrl, ctrlEmpty, capacity);
+    try {
+      slots = std::allocator<slot_type>{}.allocate(capacity);
+    } catch (...) {
+      capacity_ = capacity;
+      release();
+      throw;
+    }
+    capacity_ = capacity;
+    growthLeft = maxLoad(capacity);
+  }
+
+  void destroyAll() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<slot_type>) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl[i] >= 0) {
+          std::destroy_at(slots + i);
+        }
+      }
+    }
+  }
+
+  void release() noexcept {
+    if (ctrl == nullptr) {
+      return;
+    }
+    destroyAll();
+    ::operator delete(ctrl, std::align_val_t{groupWidth});
+    if (slots != nullptr) {
+      std::allocator<slot_type>{}.deallocate(slots, capacity_);
+    }
+    ctrl = nullptr;
+    slots = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growthLeft = 0;
+  }
+
+  std::int8_t* ctrl = nullptr;
+  slot_type* slots = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type growthLeft = 0;
+};
+}  // namespace strong::detail
+
+/**
+ * @brief Flat open addressing hash map keyed by a StrongType. The config of the
+ * key needs to enable hash and equal, lookups via the underlying type are only
+ * possible if allowUnderlyingTypeInOperator is set.
+ * @tparam Key StrongType used as key
+ * @tparam Value mapped type
+ */
+template <isStrongHashKey Key, typename Value>
+class StrongHashMap : public strong::detail::FlatTable<Key, Value> {
+  using base = strong::detail::FlatTable<Key, Value>;
+
+ public:
+  using mapped_type = Value;
+  using typename base::const_iterator;
+  using typename base::iterator;
+
+  using base::base;
+
+  /**
+   * @brief Inserts a value constructed from args if the key isn't present
+   * @param key key of the element
+   * @param ...args constructor arguments of the value
+   * @return position of the element and if it has been inserted
+   */
+  template <typename... Args>
+  auto try_emplace(const Key& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    return this->tryEmplace(key, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  auto try_emplace(Key&& key, Args&&... args) -> std::pair<iterator, bool> {
+    return this->tryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+  /**
+   * @brief Inserts the value or assigns it if the key is already present
+   * @param key key of the element
+   * @param value value to store
+   * @return position of the element and if it has been inserted
+   */
+  template <typename V>
+  auto insert_or_assign(const Key& key, V&& value)
+      -> std::pair<iterator, bool> {
+    auto result = this->tryEmplace(key, std::forward<V>(value));
+    if (!result.second) {
+      result.first->second = std::forward<V>(value);
+    }
+    return result;
+  }
+  /**
+   * @brief Access to the value, default constructs it if the key isn't present
+   * @param key key of the element
+   * @return value of the key
+   */
+  auto operator[](const Key& key) -> Value& {
+    return this->tryEmplace(key).first->second;
+  }
+  /**
+   * @brief Access to the value of an existing key
+   * @param key key of the element
+   * @return value of the key
+   */
+  [[nodiscard]] auto at(const Key& key) -> Value& {
+    return const_cast<Value&>(std::as_const(*this).at(key));
+  }
+  [[nodiscard]] auto at(const Key& key) const -> const Value& {
+    const auto index = this->findIndex(key.get());
+    if (index == this->capacity()) {
+      throw std::out_of_range("Key not found in StrongHashMap");
+    }
+    return this->mappedAt(index);
+  }
+};
+
+/**
+ * @brief Flat open addressing hash set of StrongTypes. The config needs to
+ * enable hash and equal, lookups via the underlying type are only possible if
+ * allowUnderlyingTypeInOperator is set.
+ * @tparam Key StrongType stored in the set
+ */
+template <isStrongHashKey Key>
+class StrongHashSet : public strong::detail::FlatTable<Key, void> {
+  using base = strong::detail::FlatTable<Key, void>;
+
+ public:
+  using value_type = Key;
+  using typename base::const_iterator;
+  using typename base::iterator;
+
+  using base::base;
+
+  /**
+   * @brief Inserts the key if it isn't present
+   * @param key key to insert
+   * @return position of the key and if it has been inserted
+   */
+  auto insert(const Key& key) -> std::pair<iterator, bool> {
+    return this->tryEmplace(key);
+  }
+  auto insert(Key&& key) -> std::pair<iterator, bool> {
+    return this->tryEmplace(std::move(key));
+  }
+};
@@ -0,0 +1,150 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace strong::detail {
+/**
+ * @brief Process wide unique generation of an id generator, thread local
+ * blocks of another generation are discarded
+ */
+[[nodiscard]] inline auto nextGeneratorGeneration() noexcept -> std::uint64_t {
+  static std::atomic<std::uint64_t> generations{1};
+  return generations.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace strong::detail
+
+/**
+ * @brief Concept of StrongTypes with an integral underlying type, which can be
+ * minted by StrongIdGenerator
+ */
+template <typename T>
+concept isStrongIdType = isStrongType<T> &&
+                         std::is_integral_v<typename T::type> &&
+                         !std::is_same_v<typename T::type, bool>;
+
+/**
+ * @brief Hands out unique ids of a StrongType. Every thread reserves a block of
+ * ids at once, so the shared counter is only touched once per block. Ids are
+ * increasing per thread, but not across threads.
+ * The high water mark is above every id handed out (or reserved), persist it
+ * and restore it after a restart to continue without duplicates.
+ * @tparam T StrongType with an integral underlying type
+ */
+template <isStrongIdType T>
+class StrongIdGenerator {
+ public:
+  using value_type = T;
+  using type = typename T::type;
+
+  static constexpr type defaultBlockSize = static_cast<type>(
+      std::min<std::uintmax_t>(1024, std::numeric_limits<type>::max()));
+
+  /**
+   * @brief Creates a generator
+   * @param start first id handed out, e.g. a persisted high water mark
+   * @param idsPerBlock number of ids a thread reserves at once
+   */
+  explicit StrongIdGenerator(type start = type{1},
+                             type idsPerBlock = defaultBlockSize)
+      : counter{start},
+        generation{strong::detail::nextGeneratorGeneration()},
+        blockSize{idsPerBlock} {
+    if (idsPerBlock <= type{0}) {
+      throw std::invalid_argument("StrongIdGenerator: block size must be > 0");
+    }
+  }
+  StrongIdGenerator(const StrongIdGenerator&) = delete;
+  auto operator=(const StrongIdGenerator&) -> StrongIdGenerator& = delete;
+
+  /**
+   * @brief Generator shared by the whole process for this StrongType
+   */
+  [[nodiscard]] static auto global() -> StrongIdGenerator& {
+    static StrongIdGenerator generator;
+    return generator;
+  }
+
+  /**
+   * @brief Next id of the calling thread's block
+   * @throw std::overflow_error if the underlying type is exhausted
+   */
+  [[nodiscard]] auto next() -> T {
+    auto& block = threadBlock();
+    if (block.generation != generation.load(std::memory_order_acquire) ||
+        block.next == block.end) {
+      reserve(block);
+    }
+    return T{block.next++};
+  }
+
+  /**
+   * @brief Value above every id handed out so far, including the unused ids
+   * reserved by threads
+   */
+  [[nodiscard]] auto highWaterMark() const noexcept -> type {
+    return counter.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Continues after a persisted high water mark, ids below it are not
+   * handed out anymore. Blocks reserved by threads are discarded. Must not
+   * race with next()
+   * @param mark persisted high water mark
+   */
+  void restore(type mark) noexcept {
+    auto current = counter.load(std::memory_order_relaxed);
+    while (current < mark &&
+           !counter.compare_exchange_weak(current, mark,
+                                          std::memory_order_relaxed)) {
+    }
+    generation.store(strong::detail::nextGeneratorGeneration(),
+                     std::memory_order_release);
+  }
+
+ private:
+  using unsignedType = std::make_unsigned_t<type>;
+
+  struct Block {
+    std::uint64_t generation = 0;
+    type next{};
+    type end{};
+  };
+
+  // one block per thread and StrongType, a thread switching between two
+  // generators of the same StrongType reserves a new block on every switch
+  [[nodiscard]] static auto threadBlock() noexcept -> Block& {
+    thread_local Block block;
+    return block;
+  }
+
+  void reserve(Block& block) {
+    auto current = counter.load(std::memory_order_relaxed);
+    unsignedType size = 0;
+    do {
+      const auto left = static_cast<unsignedType>(
+          static_cast<unsignedType>(std::numeric_limits<type>::max()) -
+          static_cast<unsignedType>(current));
+      if (left == 0) {
+        throw std::overflow_error("StrongIdGenerator: ids exhausted");
+      }
+      size = std::min(static_cast<unsignedType>(blockSize), left);
+    } while (!counter.compare_exchange_weak(
+        current, static_cast<type>(static_cast<unsignedType>(current) + size),
+        std::memory_order_acq_rel, std::memory_order_relaxed));
+    block.generation = generation.load(std::memory_order_acquire);
+    block.next = current;
+    block.end = static_cast<type>(static_cast<unsignedType>(current) + size);
+  }
+
+  // the counter is written once per block, keep it off the line of the
+  // generation, which every next() reads
+  alignas(64) std::atomic<type> counter;
+  alignas(64) std::atomic<std::uint64_t> generation;
+  const type blockSize;
+};
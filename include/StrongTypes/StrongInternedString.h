@@ -0,0 +1,229 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace strong {
+namespace detail {
+/**
+ * @brief Interned text, the characters follow in the same arena
+ */
+struct InternEntry {
+  std::size_t hash;
+  std::string_view text;
+};
+}  // namespace detail
+
+class InternTable;
+
+/**
+ * @brief Handle of a string in an InternTable. Equality and hashing are O(1)
+ * (pointer compare and precomputed hash), ordering compares the text. Handles
+ * of different tables must not be compared. Use it as underlyingType of a
+ * StrongType, get() converts implicitly to std::string_view
+ */
+class InternedString {
+ public:
+  /**
+   * @brief Empty string
+   */
+  constexpr InternedString() noexcept = default;
+  /**
+   * @brief Interns text into the global table
+   */
+  explicit InternedString(std::string_view text);
+  /**
+   * @brief Interns text into table, which has to outlive the handle
+   */
+  InternedString(InternTable& table, std::string_view text);
+
+  [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+    return entry != nullptr ? entry->text : std::string_view{};
+  }
+  constexpr operator std::string_view() const noexcept { return view(); }
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    return view().size();
+  }
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return entry == nullptr;
+  }
+  [[nodiscard]] constexpr auto hash() const noexcept -> std::size_t {
+    return entry != nullptr ? entry->hash : 0;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(InternedString lhs,
+                                                 InternedString rhs) noexcept
+      -> bool {
+    return lhs.entry == rhs.entry;
+  }
+  [[nodiscard]] friend constexpr auto operator<=>(InternedString lhs,
+                                                  InternedString rhs) noexcept
+      -> std::strong_ordering {
+    if (lhs.entry == rhs.entry) {
+      return std::strong_ordering::equal;
+    }
+    return lhs.view() <=> rhs.view();
+  }
+
+ private:
+  friend class InternTable;
+  explicit constexpr InternedString(const detail::InternEntry* entry) noexcept
+      : entry{entry} {}
+
+  const detail::InternEntry* entry = nullptr;
+};
+
+/**
+ * @brief Concurrent set of interned strings. The table is split into shards
+ * with their own lock and arena, lookups of already interned strings only
+ * take a shared lock. Strings live until the table is destroyed
+ */
+class InternTable {
+ public:
+  InternTable() = default;
+  InternTable(const InternTable&) = delete;
+  auto operator=(const InternTable&) -> InternTable& = delete;
+
+  /**
+   * @brief Table used by InternedString(std::string_view), never destroyed
+   */
+  [[nodiscard]] static auto global() -> InternTable& {
+    static auto* table = new InternTable{};
+    return *table;
+  }
+
+  /**
+   * @brief Handle of text, equal texts get the same handle
+   */
+  [[nodiscard]] auto intern(std::string_view text) -> InternedString {
+    if (text.empty()) {
+      return InternedString{};
+    }
+    const auto hash = std::hash<std::string_view>{}(text);
+    auto& shard = shards[hash >> shardShift];
+    const Key key{text, hash};
+    {
+      std::shared_lock lock{shard.mutex};
+      if (const auto it = shard.entries.find(key); it != shard.entries.end()) {
+        return InternedString{it->second};
+      }
+    }
+    std::unique_lock lock{shard.mutex};
+    if (const auto it = shard.entries.find(key); it != shard.entries.end()) {
+      return InternedString{it->second};
+    }
+    const auto* entry = shard.allocate(text, hash);
+    shard.entries.emplace(Key{entry->text, hash}, entry);
+    return InternedString{entry};
+  }
+
+  /**
+   * @brief Number of interned strings
+   */
+  [[nodiscard]] auto size() const -> std::size_t {
+    std::size_t count = 0;
+    for (auto& shard : shards) {
+      std::shared_lock lock{shard.mutex};
+      count += shard.entries.size();
+    }
+    return count;
+  }
+
+  /**
+   * @brief Bytes reserved by the arenas of the shards
+   */
+  [[nodiscard]] auto arenaBytes() const -> std::size_t {
+    std::size_t bytes = 0;
+    for (auto& shard : shards) {
+      std::shared_lock lock{shard.mutex};
+      bytes += shard.reserved;
+    }
+    return bytes;
+  }
+
+ private:
+  // the top bits of the hash select the shard, the low ones the bucket
+  static constexpr int shardBits = 6;
+  static constexpr std::size_t shardCount = std::size_t{1} << shardBits;
+  static constexpr int shardShift = sizeof(std::size_t) * 8 - shardBits;
+  static constexpr std::size_t blockSize = 64 * 1024;
+
+  struct Key {
+    std::string_view text;
+    std::size_t hash;
+  };
+  struct KeyHash {
+    auto operator()(const Key& key) const noexcept -> std::size_t {
+      return key.hash;
+    }
+  };
+  struct KeyEqual {
+    auto operator()(const Key& lhs, const Key& rhs) const noexcept -> bool {
+      return lhs.hash == rhs.hash && lhs.text == rhs.text;
+    }
+  };
+
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, const detail::InternEntry*, KeyHash, KeyEqual>
+        entries;
+    std::vector<std::unique_ptr<std::byte[]>> blocks;
+    std::byte* next = nullptr;
+    std::size_t left = 0;
+    std::size_t reserved = 0;
+
+    auto allocate(std::string_view text, std::size_t hash)
+        -> const detail::InternEntry* {
+      constexpr auto align = alignof(detail::InternEntry);
+      const auto bytes = (sizeof(detail::InternEntry) + text.size() + align -
+                          1) / align * align;
+      if (bytes > left) {
+        const auto size = std::max(bytes, blockSize);
+        blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+        next = blocks.back().get();
+        left = size;
+        reserved += size;
+      }
+      auto* chars = reinterpret_cast<char*>(next + sizeof(detail::InternEntry));
+      std::memcpy(chars, text.data(), text.size());
+      auto* entry = new (next)
+          detail::InternEntry{hash, std::string_view{chars, text.size()}};
+      next += bytes;
+      left -= bytes;
+      return entry;
+    }
+  };
+
+  std::array<Shard, shardCount> shards;
+};
+
+inline InternedString::InternedString(std::string_view text)
+    : InternedString{InternTable::global().intern(text)} {}
+
+inline InternedString::InternedString(InternTable& table,
+                                      std::string_view text)
+    : InternedString{table.intern(text)} {}
+}  // namespace strong
+
+namespace std {
+/**
+ * @brief Precomputed hash of an interned string
+ */
+template <>
+struct hash<strong::InternedString> {
+  [[nodiscard]] auto operator()(strong::InternedString value) const noexcept
+      -> std::size_t {
+    return value.hash();
+  }
+};
+}  // namespace std
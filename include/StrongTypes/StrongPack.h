@@ -0,0 +1,435 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace strong {
+namespace detail {
+/**
+ * @brief If every value a field of bits bits decodes into fits the storage
+ * type of T, which is narrower than the underlying type if compressed
+ */
+template <typename T, std::size_t bits>
+[[nodiscard]] consteval auto fitsStorage() -> bool {
+  using type = typename T::type;
+  using storage = typename T::storage_type;
+  if constexpr (std::is_same_v<type, storage>) {
+    return true;
+  } else if constexpr (std::is_signed_v<type>) {
+    // wider fields wrap into every value of type
+    if (bits > std::numeric_limits<type>::digits + 1) {
+      return false;
+    }
+    const auto limit = std::int64_t{1} << (bits - 1);
+    return std::in_range<storage>(-limit) && std::in_range<storage>(limit - 1);
+  } else {
+    if (bits > std::numeric_limits<type>::digits) {
+      return false;
+    }
+    return bits < 64 &&
+           std::in_range<storage>((std::uint64_t{1} << bits) - 1);
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Field of a StrongPack: a StrongType with an integral underlying type
+ * stored in the given number of bits. StrongTypes with a validator aren't
+ * supported, as every word, e.g. of fromWord, decodes into values, and the
+ * values of the bits must fit the storage type of a compressed StrongType
+ * @tparam T StrongType
+ * @tparam bits number of bits of the field
+ */
+template <isStrongType T, std::size_t bits>
+  requires std::is_integral_v<typename T::type> &&
+           (!isValidationEnabled<typename T::config_type>) && (bits > 0) &&
+           (bits <= 64) && (detail::fitsStorage<T, bits>())
+struct Field {
+  using type = T;
+  static constexpr std::size_t width = bits;
+};
+
+namespace detail {
+template <typename T>
+struct isFieldSpecialization : std::false_type {};
+template <typename T, std::size_t bits>
+struct isFieldSpecialization<Field<T, bits>> : std::true_type {};
+
+/**
+ * @brief Smallest unsigned integer with at least bits bits
+ */
+template <std::size_t bits>
+using packWord = std::conditional_t<
+    bits <= 8, std::uint8_t,
+    std::conditional_t<
+        bits <= 16, std::uint16_t,
+        std::conditional_t<bits <= 32, std::uint32_t, std::uint64_t>>>;
+
+[[nodiscard]] constexpr auto fieldMask(std::size_t bits) noexcept
+    -> std::uint64_t {
+  return bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+}
+
+/**
+ * @brief If value can be stored in bits bits. Signed values are stored with an
+ * offset of 2^(bits - 1), so the unsigned order of the bits is their order
+ */
+template <typename type>
+[[nodiscard]] constexpr auto fitsField(type value, std::size_t bits) noexcept
+    -> bool {
+  if (bits == 64) {
+    return true;
+  }
+  if constexpr (std::is_signed_v<type>) {
+    const auto limit = std::int64_t{1} << (bits - 1);
+    return static_cast<std::int64_t>(value) >= -limit &&
+           static_cast<std::int64_t>(value) < limit;
+  } else {
+    return (static_cast<std::uint64_t>(value) >> bits) == 0;
+  }
+}
+template <typename type>
+[[nodiscard]] constexpr auto encodeField(type value, std::size_t bits) noexcept
+    -> std::uint64_t {
+  auto raw = static_cast<std::uint64_t>(value);
+  if constexpr (std::is_signed_v<type>) {
+    raw += std::uint64_t{1} << (bits - 1);
+  }
+  return raw & fieldMask(bits);
+}
+template <typename type>
+[[nodiscard]] constexpr auto decodeField(std::uint64_t raw,
+                                         std::size_t bits) noexcept -> type {
+  if constexpr (std::is_same_v<type, bool>) {
+    return raw != 0;
+  } else if constexpr (std::is_signed_v<type>) {
+    return static_cast<type>(
+        static_cast<std::int64_t>(raw - (std::uint64_t{1} << (bits - 1))));
+  } else {
+    return static_cast<type>(raw);
+  }
+}
+}  // namespace detail
+
+/**
+ * @brief Concept of the fields of a StrongPack
+ */
+template <typename T>
+concept isPackField = detail::isFieldSpecialization<T>::value;
+}  // namespace strong
+
+/**
+ * @brief Packs several small StrongTypes into one unsigned integer, e.g.
+ * StrongPack<strong::Field<ShardId, 10>, strong::Field<Version, 22>> is 4
+ * bytes. The first field occupies the most significant bits, so comparing the
+ * words compares the fields lexicographically. Comparison and hashing are
+ * available if the configs of all fields enable them
+ * @tparam fields strong::Field of every StrongType, at most 64 bits in total
+ */
+template <strong::isPackField... fields>
+  requires(sizeof...(fields) > 0)
+class StrongPack {
+ public:
+  static constexpr std::size_t bits = (fields::width + ...);
+  static_assert(bits <= 64, "StrongPack: the fields need more than 64 bits");
+  using word_type = strong::detail::packWord<bits>;
+
+  /**
+   * @brief StrongType of the field at index
+   */
+  template <std::size_t index>
+  using field_type =
+      std::tuple_element_t<index, std::tuple<typename fields::type...>>;
+
+  /**
+   * @brief Default Constructor, every field is 0
+   */
+  constexpr StrongPack() noexcept = default;
+  /**
+   * @brief Packs a value for every field
+   * @param values values in the order of the fields
+   * @throw std::invalid_argument if a value doesn't fit the bits of its field
+   */
+  constexpr explicit StrongPack(const typename fields::type&... values) {
+    [&]<std::size_t... index>(std::index_sequence<index...>) {
+      (set<index>(values), ...);
+    }(std::index_sequence_for<fields...>{});
+  }
+
+  /**
+   * @brief Reinterprets a word, e.g. one which was persisted via toWord()
+   * @param word packed fields
+   * @return StrongPack
+   */
+  [[nodiscard]] static constexpr auto fromWord(word_type word) noexcept
+      -> StrongPack {
+    StrongPack pack;
+    pack.word = word;
+    return pack;
+  }
+  /**
+   * @brief The packed fields
+   * @return word
+   */
+  [[nodiscard]] constexpr auto toWord() const noexcept -> word_type {
+    return word;
+  }
+
+  /**
+   * @brief Value of the field at index
+   * @return value
+   */
+  template <std::size_t index>
+    requires(index < sizeof...(fields))
+  [[nodiscard]] constexpr auto get() const noexcept -> field_type<index> {
+    using T = field_type<index>;
+    const auto raw = (static_cast<std::uint64_t>(word) >> shift<index>()) &
+                     strong::detail::fieldMask(width<index>());
+    return T{strong::unchecked, strong::detail::decodeField<typename T::type>(
+                                    raw, width<index>())};
+  }
+  /**
+   * @brief Value of the field of type T, which must be unique in the pack
+   * @return value
+   */
+  template <typename T>
+    requires(strong::detail::indexOf<T, typename fields::type...>() <
+             sizeof...(fields))
+  [[nodiscard]] constexpr auto get() const noexcept -> T {
+    return get<strong::detail::indexOf<T, typename fields::type...>()>();
+  }
+
+  /**
+   * @brief Sets the field at index
+   * @param value new value
+   * @throw std::invalid_argument if the value doesn't fit the bits of the field
+   */
+  template <std::size_t index>
+    requires(index < sizeof...(fields))
+  constexpr void set(const field_type<index>& value) {
+    if (!strong::detail::fitsField(value.get(), width<index>())) {
+      throw std::invalid_argument{"StrongPack: value exceeds its field"};
+    }
+    set<index>(strong::unchecked, value);
+  }
+  /**
+   * @brief Sets the field at index without checking if the value fits, excess
+   * bits are cut off
+   * @param value new value
+   */
+  template <std::size_t index>
+    requires(index < sizeof...(fields))
+  constexpr void set(strong::unchecked_t,
+                     const field_type<index>& value) noexcept {
+    constexpr auto mask = strong::detail::fieldMask(width<index>())
+                          << shift<index>();
+    const auto raw = strong::detail::encodeField(value.get(), width<index>())
+                     << shift<index>();
+    word = static_cast<word_type>((static_cast<std::uint64_t>(word) & ~mask) |
+                                  raw);
+  }
+  /**
+   * @brief Sets the field of type T, which must be unique in the pack
+   * @param value new value
+   * @throw std::invalid_argument if the value doesn't fit the bits of the field
+   */
+  template <typename T>
+    requires(strong::detail::indexOf<T, typename fields::type...>() <
+             sizeof...(fields))
+  constexpr void set(const T& value) {
+    set<strong::detail::indexOf<T, typename fields::type...>()>(value);
+  }
+  template <typename T>
+    requires(strong::detail::indexOf<T, typename fields::type...>() <
+             sizeof...(fields))
+  constexpr void set(strong::unchecked_t, const T& value) noexcept {
+    set<strong::detail::indexOf<T, typename fields::type...>()>(
+        strong::unchecked, value);
+  }
+
+  /**
+   * @brief Equality of all fields in a single comparison of the words, only
+   * available if every field enables operator==
+   */
+  [[nodiscard]] constexpr auto operator==(const StrongPack& rhs) const noexcept
+      -> bool
+    requires(static_cast<bool>(fields::type::config_type::equal) && ...)
+  {
+    return word == rhs.word;
+  }
+  /**
+   * @brief Lexicographic order of the fields in a single comparison of the
+   * words, only available if every field enables the spaceship operator
+   */
+  [[nodiscard]] constexpr auto operator<=>(const StrongPack& rhs) const noexcept
+      -> std::strong_ordering
+    requires(static_cast<bool>(fields::type::config_type::spaceship) && ...)
+  {
+    return word <=> rhs.word;
+  }
+
+ private:
+  template <std::size_t index>
+  [[nodiscard]] static constexpr auto width() noexcept -> std::size_t {
+    return std::tuple_element_t<index, std::tuple<fields...>>::width;
+  }
+  // bits of the fields after index, the first field is the most significant
+  template <std::size_t index>
+  [[nodiscard]] static constexpr auto shift() noexcept -> std::size_t {
+    constexpr std::size_t widths[] = {fields::width...};
+    std::size_t below = 0;
+    for (std::size_t i = index + 1; i < sizeof...(fields); ++i) {
+      below += widths[i];
+    }
+    return below;
+  }
+  // signed fields are stored with an offset, so 0 isn't the bits 0
+  [[nodiscard]] static constexpr auto zeroWord() noexcept -> word_type {
+    return []<std::size_t... index>(std::index_sequence<index...>) {
+      return static_cast<word_type>(
+          ((strong::detail::encodeField(typename fields::type::type{},
+                                        fields::width)
+            << shift<index>()) |
+           ...));
+    }(std::index_sequence_for<fields...>{});
+  }
+
+  word_type word = zeroWord();
+};
+
+namespace strong::detail {
+template <typename T>
+struct isStrongPackSpecialization : std::false_type {};
+template <typename... fields>
+struct isStrongPackSpecialization<StrongPack<fields...>> : std::true_type {};
+}  // namespace strong::detail
+
+/**
+ * @brief Concept if T is a StrongPack
+ */
+template <typename T>
+concept isStrongPack = strong::detail::isStrongPackSpecialization<T>::value;
+
+/**
+ * @brief Atomic StrongPack, the fields can be updated individually by a
+ * compare and swap of the whole word, so every load sees a consistent pack
+ * @tparam pack StrongPack
+ */
+template <isStrongPack pack>
+class StrongAtomicPack {
+ public:
+  using value_type = pack;
+  using word_type = typename pack::word_type;
+
+  /**
+   * @brief Default Constructor, every field is 0
+   */
+  StrongAtomicPack() noexcept = default;
+  constexpr explicit StrongAtomicPack(pack initial) noexcept
+      : word{initial.toWord()} {}
+  StrongAtomicPack(const StrongAtomicPack&) = delete;
+  auto operator=(const StrongAtomicPack&) -> StrongAtomicPack& = delete;
+
+  [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst)
+      const noexcept -> pack {
+    return pack::fromWord(word.load(order));
+  }
+  void store(pack desired,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    word.store(desired.toWord(), order);
+  }
+  auto exchange(pack desired,
+                std::memory_order order = std::memory_order_seq_cst) noexcept
+      -> pack {
+    return pack::fromWord(word.exchange(desired.toWord(), order));
+  }
+  /**
+   * @brief Replaces the pack if it still is expected, otherwise expected is
+   * updated to the current one
+   * @return true if replaced
+   */
+  auto compare_exchange_weak(
+      pack& expected, pack desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    auto raw = expected.toWord();
+    const bool exchanged =
+        word.compare_exchange_weak(raw, desired.toWord(), order);
+    expected = pack::fromWord(raw);
+    return exchanged;
+  }
+  auto compare_exchange_strong(
+      pack& expected, pack desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    auto raw = expected.toWord();
+    const bool exchanged =
+        word.compare_exchange_strong(raw, desired.toWord(), order);
+    expected = pack::fromWord(raw);
+    return exchanged;
+  }
+
+  /**
+   * @brief Value of the field of type T
+   */
+  template <typename T>
+  [[nodiscard]] auto get(std::memory_order order =
+                             std::memory_order_seq_cst) const noexcept -> T {
+    return load(order).template get<T>();
+  }
+  /**
+   * @brief Sets the field of type T, leaving the other fields as they are
+   * @param value new value
+   * @return the previous pack
+   * @throw std::invalid_argument if the value doesn't fit the bits of the field
+   */
+  template <typename T>
+  auto set(const T& value,
+           std::memory_order order = std::memory_order_seq_cst) -> pack {
+    pack{}.set(value);  // throws before anything is changed
+    return update([&](pack current) {
+      current.set(strong::unchecked, value);
+      return current;
+    }, order);
+  }
+  /**
+   * @brief Replaces the pack by function(pack) in a compare and swap loop, the
+   * function can be called more than once
+   * @param function pack -> pack
+   * @return the previous pack
+   */
+  template <typename func>
+    requires std::is_invocable_r_v<pack, func&, pack>
+  auto update(func function,
+              std::memory_order order = std::memory_order_seq_cst) -> pack {
+    auto expected = load(std::memory_order_relaxed);
+    while (!compare_exchange_weak(expected, function(expected), order)) {
+    }
+    return expected;
+  }
+
+ private:
+  std::atomic<word_type> word{pack{}.toWord()};
+};
+
+namespace std {
+/**
+ * @brief Hash of the word of a StrongPack, only available if every field
+ * enables hashing
+ */
+template <typename... fields>
+  requires(isHashEnabled<typename fields::type::config_type> && ...)
+struct hash<StrongPack<fields...>> {
+  [[nodiscard]] constexpr auto operator()(
+      const StrongPack<fields...>& value) const noexcept -> std::size_t {
+    return strong::hashValue(value.toWord());
+  }
+};
+}  // namespace std
@@ -0,0 +1,517 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Instruction sets are selected at compile time (-mavx2, /arch:AVX2, ...), the
+// kernels fall back to scalar code if none of them is available
+#if defined(__AVX512F__)
+#define STRONGTYPES_AVX512 1
+#endif
+#if defined(__AVX2__)
+#define STRONGTYPES_AVX2 1
+#endif
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define STRONGTYPES_SSE42 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STRONGTYPES_SSE2 1
+#endif
+
+#if defined(STRONGTYPES_AVX512) || defined(STRONGTYPES_AVX2)
+#include <immintrin.h>
+#elif defined(STRONGTYPES_SSE42)
+#include <nmmintrin.h>
+#elif defined(STRONGTYPES_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace strong::detail {
+/**
+ * @brief Kind of SIMD lane an underlying type maps to
+ */
+enum class lane { none, i32, i64, u32, u64, f32, f64 };
+
+/**
+ * @brief Lane of an arithmetic type, types without SIMD kernels map to none
+ * @tparam T arithmetic type
+ */
+template <typename T>
+[[nodiscard]] consteval auto laneOf() noexcept -> lane {
+  if constexpr (std::is_same_v<T, float>) {
+    return lane::f32;
+  } else if constexpr (std::is_same_v<T, double>) {
+    return lane::f64;
+  } else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+    if constexpr (sizeof(T) == 4) {
+      return std::is_signed_v<T> ? lane::i32 : lane::u32;
+    } else if constexpr (sizeof(T) == 8) {
+      return std::is_signed_v<T> ? lane::i64 : lane::u64;
+    } else {
+      return lane::none;
+    }
+  } else {
+    return lane::none;
+  }
+}
+
+/**
+ * @brief SIMD register of one lane kind. Every specialization provides width,
+ * load, store, set1, eq/lt/gt returning a bitmask with one bit per lane, and
+ * min/max. The primary template has no kernels.
+ * @tparam kind lane kind
+ */
+template <lane kind>
+struct Batch {
+  static constexpr bool available = false;
+};
+
+#if defined(STRONGTYPES_AVX512)
+template <>
+struct Batch<lane::i32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 16;
+  using value_type = std::int32_t;
+  using reg = __m512i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm512_loadu_si512(p);
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm512_storeu_si512(p, v);
+  }
+  static auto set1(value_type v) noexcept -> reg {
+    return _mm512_set1_epi32(v);
+  }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmpeq_epi32_mask(a, b);
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmplt_epi32_mask(a, b);
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmpgt_epi32_mask(a, b);
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return _mm512_min_epi32(a, b);
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return _mm512_max_epi32(a, b);
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm512_xor_si512(v, _mm512_set1_epi32(INT32_MIN));
+  }
+};
+template <>
+struct Batch<lane::i64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 8;
+  using value_type = std::int64_t;
+  using reg = __m512i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm512_loadu_si512(p);
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm512_storeu_si512(p, v);
+  }
+  static auto set1(value_type v) noexcept -> reg {
+    return _mm512_set1_epi64(v);
+  }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmpeq_epi64_mask(a, b);
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmplt_epi64_mask(a, b);
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmpgt_epi64_mask(a, b);
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return _mm512_min_epi64(a, b);
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return _mm512_max_epi64(a, b);
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm512_xor_si512(v, _mm512_set1_epi64(INT64_MIN));
+  }
+};
+template <>
+struct Batch<lane::f32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 16;
+  using value_type = float;
+  using reg = __m512;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm512_loadu_ps(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm512_storeu_ps(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm512_set1_ps(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm512_min_ps(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm512_max_ps(a, b); }
+};
+template <>
+struct Batch<lane::f64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 8;
+  using value_type = double;
+  using reg = __m512d;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm512_loadu_pd(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm512_storeu_pd(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm512_set1_pd(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm512_min_pd(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm512_max_pd(a, b); }
+};
+#elif defined(STRONGTYPES_AVX2)
+template <>
+struct Batch<lane::i32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 8;
+  using value_type = std::int32_t;
+  using reg = __m256i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static auto set1(value_type v) noexcept -> reg {
+    return _mm256_set1_epi32(v);
+  }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpeq_epi32(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpgt_epi32(b, a));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpgt_epi32(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return _mm256_min_epi32(a, b);
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return _mm256_max_epi32(a, b);
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm256_xor_si256(v, _mm256_set1_epi32(INT32_MIN));
+  }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+  }
+};
+template <>
+struct Batch<lane::i64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 4;
+  using value_type = std::int64_t;
+  using reg = __m256i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static auto set1(value_type v) noexcept -> reg {
+    return _mm256_set1_epi64x(v);
+  }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpeq_epi64(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpgt_epi64(b, a));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmpgt_epi64(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm256_xor_si256(v, _mm256_set1_epi64x(INT64_MIN));
+  }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(
+        _mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+  }
+};
+template <>
+struct Batch<lane::f32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 8;
+  using value_type = float;
+  using reg = __m256;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm256_loadu_ps(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm256_storeu_ps(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm256_set1_ps(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm256_min_ps(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_ps(a, b); }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(mask));
+  }
+};
+template <>
+struct Batch<lane::f64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 4;
+  using value_type = double;
+  using reg = __m256d;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm256_loadu_pd(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm256_storeu_pd(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm256_set1_pd(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm256_min_pd(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_pd(a, b); }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm256_movemask_pd(mask));
+  }
+};
+#elif defined(STRONGTYPES_SSE2)
+template <>
+struct Batch<lane::i32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 4;
+  using value_type = std::int32_t;
+  using reg = __m128i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+  static auto set1(value_type v) noexcept -> reg { return _mm_set1_epi32(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpeq_epi32(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmplt_epi32(a, b));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpgt_epi32(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return select(_mm_cmpgt_epi32(a, b), b, a);
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return select(_mm_cmpgt_epi32(a, b), a, b);
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm_xor_si128(v, _mm_set1_epi32(INT32_MIN));
+  }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(mask)));
+  }
+  static auto select(reg mask, reg a, reg b) noexcept -> reg {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+  }
+};
+#if defined(STRONGTYPES_SSE42)
+template <>
+struct Batch<lane::i64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 2;
+  using value_type = std::int64_t;
+  using reg = __m128i;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  static void store(value_type* p, reg v) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+  static auto set1(value_type v) noexcept -> reg { return _mm_set1_epi64x(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpeq_epi64(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpgt_epi64(b, a));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpgt_epi64(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg {
+    return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b));
+  }
+  static auto max(reg a, reg b) noexcept -> reg {
+    return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(b, a));
+  }
+  static auto flip(reg v) noexcept -> reg {
+    return _mm_xor_si128(v, _mm_set1_epi64x(INT64_MIN));
+  }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(mask)));
+  }
+};
+#endif
+template <>
+struct Batch<lane::f32> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 4;
+  using value_type = float;
+  using reg = __m128;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm_loadu_ps(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm_storeu_ps(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm_set1_ps(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpeq_ps(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmplt_ps(a, b));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpgt_ps(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm_min_ps(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm_max_ps(a, b); }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm_movemask_ps(mask));
+  }
+};
+template <>
+struct Batch<lane::f64> {
+  static constexpr bool available = true;
+  static constexpr std::size_t width = 2;
+  using value_type = double;
+  using reg = __m128d;
+  static auto load(const value_type* p) noexcept -> reg {
+    return _mm_loadu_pd(p);
+  }
+  static void store(value_type* p, reg v) noexcept { _mm_storeu_pd(p, v); }
+  static auto set1(value_type v) noexcept -> reg { return _mm_set1_pd(v); }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpeq_pd(a, b));
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmplt_pd(a, b));
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return bits(_mm_cmpgt_pd(a, b));
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return _mm_min_pd(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return _mm_max_pd(a, b); }
+
+ private:
+  static auto bits(reg mask) noexcept -> std::uint64_t {
+    return static_cast<std::uint32_t>(_mm_movemask_pd(mask));
+  }
+};
+#endif
+
+/**
+ * @brief Unsigned lanes reuse the signed kernels on values with a flipped sign
+ * bit, which maps the unsigned order onto the signed one
+ * @tparam signedKind signed lane of the same width
+ * @tparam unsignedType unsigned value type
+ */
+template <lane signedKind, typename unsignedType>
+struct FlippedBatch {
+  using base = Batch<signedKind>;
+  static constexpr bool available = base::available;
+  static constexpr std::size_t width = base::width;
+  using value_type = unsignedType;
+  using reg = typename base::reg;
+  static auto load(const value_type* p) noexcept -> reg {
+    return base::flip(
+        base::load(reinterpret_cast<const typename base::value_type*>(p)));
+  }
+  static void store(value_type* p, reg v) noexcept {
+    base::store(reinterpret_cast<typename base::value_type*>(p),
+                base::flip(v));
+  }
+  static auto set1(value_type v) noexcept -> reg {
+    return base::flip(base::set1(static_cast<typename base::value_type>(v)));
+  }
+  static auto eq(reg a, reg b) noexcept -> std::uint64_t {
+    return base::eq(a, b);
+  }
+  static auto lt(reg a, reg b) noexcept -> std::uint64_t {
+    return base::lt(a, b);
+  }
+  static auto gt(reg a, reg b) noexcept -> std::uint64_t {
+    return base::gt(a, b);
+  }
+  static auto min(reg a, reg b) noexcept -> reg { return base::min(a, b); }
+  static auto max(reg a, reg b) noexcept -> reg { return base::max(a, b); }
+};
+template <>
+struct Batch<lane::u32>
+    : std::conditional_t<Batch<lane::i32>::available,
+                         FlippedBatch<lane::i32, std::uint32_t>,
+                         Batch<lane::none>> {};
+template <>
+struct Batch<lane::u64>
+    : std::conditional_t<Batch<lane::i64>::available,
+                         FlippedBatch<lane::i64, std::uint64_t>,
+                         Batch<lane::none>> {};
+
+/**
+ * @brief SIMD kernels of an arithmetic type, if there are any for the current
+ * instruction set
+ * @tparam T arithmetic type
+ */
+template <typename T>
+using BatchOf = Batch<laneOf<T>()>;
+
+template <typename T>
+concept hasBatch = BatchOf<T>::available;
+}  // namespace strong::detail
@@ -0,0 +1,261 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong {
+/**
+ * @brief Config of the default handle of a StrongSlotMap, handles are only
+ * compared for equality and hashable
+ * @tparam Tag distinguishes the handles of different tables
+ */
+template <typename Tag>
+struct HandleConfig {
+  using underlyingType = std::uint64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+}  // namespace strong
+
+/**
+ * @brief Generational handle into a StrongSlotMap: the slot index in the lower
+ * and its generation in the upper 32 bits of the underlying integer
+ * @tparam Tag distinguishes the handles of different tables
+ */
+template <typename Tag>
+using StrongHandle = StrongType<strong::HandleConfig<Tag>>;
+
+/**
+ * @brief Concept of a StrongType usable as handle of a StrongSlotMap, any
+ * config over std::uint64_t with operator==, e.g. to order handles as well
+ */
+template <typename T>
+concept isStrongHandle =
+    isStrongType<T> && std::is_same_v<typename T::type, std::uint64_t> &&
+    static_cast<bool>(T::config_type::equal);
+
+namespace strong {
+/**
+ * @brief Creates a handle from its slot index and generation
+ */
+template <isStrongHandle Handle>
+[[nodiscard]] constexpr auto makeHandle(std::uint32_t index,
+                                        std::uint32_t generation) -> Handle {
+  return Handle{static_cast<std::uint64_t>(generation) << 32 | index};
+}
+template <isStrongHandle Handle>
+[[nodiscard]] constexpr auto handleIndex(const Handle& handle) noexcept
+    -> std::uint32_t {
+  return static_cast<std::uint32_t>(handle.get());
+}
+template <isStrongHandle Handle>
+[[nodiscard]] constexpr auto handleGeneration(const Handle& handle) noexcept
+    -> std::uint32_t {
+  return static_cast<std::uint32_t>(handle.get() >> 32);
+}
+}  // namespace strong
+
+/**
+ * @brief Dense slot map: values are stored contiguously and addressed by
+ * generational handles. Insert, erase and lookup are O(1), erased slots are
+ * reused via a free list and a handle of an erased value is detected as stale
+ * by its generation. Erasing moves the last value into the gap, so the order
+ * of the values is not stable
+ * @tparam Handle StrongHandle<Tag> or another handle StrongType
+ * @tparam T type of the values
+ */
+template <isStrongHandle Handle, typename T>
+class StrongSlotMap {
+ public:
+  using handle_type = Handle;
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<T>::iterator;
+  using const_iterator = typename std::vector<T>::const_iterator;
+
+  /**
+   * @brief Inserts a value
+   * @return handle of the value
+   * @throw std::length_error if there are 2^32 - 1 slots already
+   */
+  auto insert(const T& value) -> Handle { return emplace(value); }
+  auto insert(T&& value) -> Handle { return emplace(std::move(value)); }
+  /**
+   * @brief Constructs a value in place
+   * @return handle of the value
+   * @throw std::length_error if there are 2^32 - 1 slots already
+   */
+  template <typename... Args>
+    requires std::is_constructible_v<T, Args...>
+  auto emplace(Args&&... args) -> Handle {
+    const auto index = acquireSlot();
+    auto& slot = slots[index];
+    try {
+      values.emplace_back(std::forward<Args>(args)...);
+      slotOfValue.push_back(index);
+    } catch (...) {
+      if (values.size() > slotOfValue.size()) {
+        values.pop_back();
+      }
+      releaseSlot(index);
+      throw;
+    }
+    slot.position = static_cast<std::uint32_t>(values.size() - 1);
+    ++slot.generation;  // odd while occupied
+    return strong::makeHandle<Handle>(index, slot.generation);
+  }
+  /**
+   * @brief Removes the value of a handle, the handle becomes stale
+   * @return false if the handle was stale already
+   */
+  auto erase(const Handle& handle) -> bool {
+    const auto index = strong::handleIndex(handle);
+    if (!isLive(handle)) {
+      return false;
+    }
+    auto& slot = slots[index];
+    const auto position = slot.position;
+    if (position + 1 != values.size()) {
+      values[position] = std::move(values.back());
+      slotOfValue[position] = slotOfValue.back();
+      slots[slotOfValue[position]].position = position;
+    }
+    values.pop_back();
+    slotOfValue.pop_back();
+    ++slot.generation;  // even while free
+    releaseSlot(index);
+    return true;
+  }
+
+  /**
+   * @brief Value of a handle
+   * @return pointer to the value or nullptr if the handle is stale
+   */
+  [[nodiscard]] auto find(const Handle& handle) noexcept -> T* {
+    return isLive(handle)
+               ? &values[slots[strong::handleIndex(handle)].position]
+               : nullptr;
+  }
+  [[nodiscard]] auto find(const Handle& handle) const noexcept -> const T* {
+    return isLive(handle)
+               ? &values[slots[strong::handleIndex(handle)].position]
+               : nullptr;
+  }
+  [[nodiscard]] auto contains(const Handle& handle) const noexcept -> bool {
+    return isLive(handle);
+  }
+  /**
+   * @brief Access to the value of a handle
+   * @throw std::out_of_range if the handle is stale
+   */
+  [[nodiscard]] auto at(const Handle& handle) -> T& {
+    return const_cast<T&>(std::as_const(*this).at(handle));
+  }
+  [[nodiscard]] auto at(const Handle& handle) const -> const T& {
+    const auto* value = find(handle);
+    if (value == nullptr) {
+      throw std::out_of_range("Stale handle in StrongSlotMap");
+    }
+    return *value;
+  }
+
+  /**
+   * @brief Handle of the value at a position of the dense storage, e.g. while
+   * iterating
+   */
+  [[nodiscard]] auto handleAt(size_type position) const noexcept -> Handle {
+    const auto index = slotOfValue[position];
+    return strong::makeHandle<Handle>(index, slots[index].generation);
+  }
+  /**
+   * @brief The contiguous values in no particular order
+   */
+  [[nodiscard]] auto data() noexcept -> std::span<T> { return values; }
+  [[nodiscard]] auto data() const noexcept -> std::span<const T> {
+    return values;
+  }
+  [[nodiscard]] auto begin() noexcept -> iterator { return values.begin(); }
+  [[nodiscard]] auto end() noexcept -> iterator { return values.end(); }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return values.begin();
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return values.end();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return values.size();
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return values.empty(); }
+  void reserve(size_type count) {
+    values.reserve(count);
+    slotOfValue.reserve(count);
+    slots.reserve(count);
+  }
+  /**
+   * @brief Removes all values, every handle becomes stale
+   */
+  void clear() noexcept {
+    for (const auto index : slotOfValue) {
+      ++slots[index].generation;
+      releaseSlot(index);
+    }
+    values.clear();
+    slotOfValue.clear();
+  }
+
+ private:
+  static constexpr std::uint32_t noSlot =
+      std::numeric_limits<std::uint32_t>::max();
+
+  // position of the value while occupied, the next free slot while free
+  struct Slot {
+    std::uint32_t position;
+    std::uint32_t generation;
+  };
+
+  [[nodiscard]] auto isLive(const Handle& handle) const noexcept -> bool {
+    const auto index = strong::handleIndex(handle);
+    const auto generation = strong::handleGeneration(handle);
+    return index < slots.size() && slots[index].generation == generation &&
+           (generation & 1) != 0;
+  }
+  auto acquireSlot() -> std::uint32_t {
+    if (freeHead != noSlot) {
+      const auto index = freeHead;
+      freeHead = slots[index].position;
+      return index;
+    }
+    if (slots.size() == noSlot) {
+      throw std::length_error("StrongSlotMap: no free slots");
+    }
+    slots.push_back({noSlot, 0});
+    return static_cast<std::uint32_t>(slots.size() - 1);
+  }
+  void releaseSlot(std::uint32_t index) noexcept {
+    slots[index].position = freeHead;
+    freeHead = index;
+  }
+
+  std::vector<T> values;
+  std::vector<std::uint32_t> slotOfValue;
+  std::vector<Slot> slots;
+  std::uint32_t freeHead = noSlot;
+};
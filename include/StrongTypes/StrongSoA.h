@@ -0,0 +1,444 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <isStrongType... Ts>
+  requires(sizeof...(Ts) > 0)
+class StrongSoA;
+
+namespace strong {
+namespace detail {
+/**
+ * @brief Columns start at a cache line, so SIMD loads of the first elements
+ * don't straddle two lines
+ */
+template <typename T>
+inline constexpr std::size_t columnAlignment =
+    std::max<std::size_t>(64, alignof(T));
+
+struct AlignedDelete {
+  template <typename T>
+  void operator()(T* column) const noexcept {
+    ::operator delete(column, std::align_val_t{columnAlignment<T>});
+  }
+};
+template <typename T>
+using ColumnPtr = std::unique_ptr<T, AlignedDelete>;
+
+template <typename T>
+[[nodiscard]] auto allocateColumn(std::size_t capacity) -> ColumnPtr<T> {
+  return ColumnPtr<T>{static_cast<T*>(::operator new(
+      capacity * sizeof(T), std::align_val_t{columnAlignment<T>}))};
+}
+}  // namespace detail
+
+/**
+ * @brief Proxy of a row of a StrongSoA, which behaves like a struct of
+ * references to the fields: get<T>() / get<index>() and structured bindings
+ * @tparam isConst if the fields are read only
+ * @tparam Ts StrongTypes of the columns
+ */
+template <bool isConst, typename... Ts>
+class SoARow {
+ public:
+  using owner_type =
+      std::conditional_t<isConst, const StrongSoA<Ts...>, StrongSoA<Ts...>>;
+  template <typename T>
+  using reference = std::conditional_t<isConst, const T&, T&>;
+
+  constexpr SoARow(owner_type& soa, std::size_t row) noexcept
+      : owner{&soa}, index{row} {}
+  /**
+   * @brief A mutable row converts to a read only one
+   */
+  constexpr operator SoARow<true, Ts...>() const noexcept
+    requires(!isConst)
+  {
+    return {*owner, index};
+  }
+
+  /**
+   * @brief Field at index of this row
+   */
+  template <std::size_t field>
+  [[nodiscard]] constexpr auto get() const noexcept
+      -> reference<std::tuple_element_t<field, std::tuple<Ts...>>> {
+    return owner->template column<field>()[index];
+  }
+  /**
+   * @brief Field of type T of this row
+   */
+  template <typename T>
+    requires(detail::indexOf<T, Ts...>() < sizeof...(Ts))
+  [[nodiscard]] constexpr auto get() const noexcept -> reference<T> {
+    return get<detail::indexOf<T, Ts...>()>();
+  }
+  /**
+   * @brief Copy of the fields
+   */
+  [[nodiscard]] constexpr auto values() const -> std::tuple<Ts...> {
+    return [this]<std::size_t... field>(std::index_sequence<field...>) {
+      return std::tuple<Ts...>{get<field>()...};
+    }(std::index_sequence_for<Ts...>{});
+  }
+  /**
+   * @brief Assigns all fields of the row
+   * @param fields new values
+   */
+  constexpr auto operator=(const std::tuple<Ts...>& fields) const
+      -> const SoARow&
+    requires(!isConst)
+  {
+    [&]<std::size_t... field>(std::index_sequence<field...>) {
+      ((get<field>() = std::get<field>(fields)), ...);
+    }(std::index_sequence_for<Ts...>{});
+    return *this;
+  }
+  [[nodiscard]] constexpr auto row() const noexcept -> std::size_t {
+    return index;
+  }
+
+ private:
+  owner_type* owner;
+  std::size_t index;
+};
+}  // namespace strong
+
+namespace std {
+/**
+ * @brief Rows of a StrongSoA can be used in structured bindings
+ */
+template <bool isConst, typename... Ts>
+struct tuple_size<strong::SoARow<isConst, Ts...>>
+    : integral_constant<size_t, sizeof...(Ts)> {};
+template <size_t index, bool isConst, typename... Ts>
+struct tuple_element<index, strong::SoARow<isConst, Ts...>> {
+  using type = typename strong::SoARow<isConst, Ts...>::template reference<
+      tuple_element_t<index, tuple<Ts...>>>;
+};
+}  // namespace std
+
+/**
+ * @brief Structure of arrays container for records of StrongTypes. Every field
+ * is stored in its own contiguous, cache line aligned column, so scanning one
+ * field only touches its column. Rows are accessed via proxies
+ * @tparam Ts StrongTypes of the columns, nothrow move constructible
+ */
+template <isStrongType... Ts>
+  requires(sizeof...(Ts) > 0)
+class StrongSoA {
+  static_assert((std::is_nothrow_move_constructible_v<Ts> && ...),
+                "StrongSoA: columns must be nothrow move constructible");
+
+ public:
+  using size_type = std::size_t;
+  using row = strong::SoARow<false, Ts...>;
+  using const_row = strong::SoARow<true, Ts...>;
+  template <std::size_t index>
+  using column_type = std::tuple_element_t<index, std::tuple<Ts...>>;
+
+  /**
+   * @brief Iterator over the rows, which dereferences to a proxy. It supports
+   * random access arithmetic, but is only an input iterator for the standard
+   * algorithms, as the proxy is no reference to a value_type
+   */
+  template <bool isConst>
+  class basic_iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::tuple<Ts...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = strong::SoARow<isConst, Ts...>;
+    using owner_type = typename reference::owner_type;
+
+    basic_iterator() = default;
+    basic_iterator(owner_type& soa, size_type row) noexcept
+        : owner{&soa}, index{row} {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+      return {*owner, index};
+    }
+    [[nodiscard]] auto operator[](difference_type offset) const noexcept
+        -> reference {
+      return {*owner, index + static_cast<size_type>(offset)};
+    }
+    auto operator++() noexcept -> basic_iterator& {
+      ++index;
+      return *this;
+    }
+    auto operator++(int) noexcept -> basic_iterator {
+      auto previous = *this;
+      ++index;
+      return previous;
+    }
+    auto operator--() noexcept -> basic_iterator& {
+      --index;
+      return *this;
+    }
+    auto operator--(int) noexcept -> basic_iterator {
+      auto previous = *this;
+      --index;
+      return previous;
+    }
+    auto operator+=(difference_type offset) noexcept -> basic_iterator& {
+      index += static_cast<size_type>(offset);
+      return *this;
+    }
+    auto operator-=(difference_type offset) noexcept -> basic_iterator& {
+      index -= static_cast<size_type>(offset);
+      return *this;
+    }
+    [[nodiscard]] friend auto operator+(basic_iterator it,
+                                        difference_type offset) noexcept
+        -> basic_iterator {
+      return it += offset;
+    }
+    [[nodiscard]] friend auto operator-(basic_iterator it,
+                                        difference_type offset) noexcept
+        -> basic_iterator {
+      return it -= offset;
+    }
+    [[nodiscard]] friend auto operator-(const basic_iterator& lhs,
+                                        const basic_iterator& rhs) noexcept
+        -> difference_type {
+      return static_cast<difference_type>(lhs.index) -
+             static_cast<difference_type>(rhs.index);
+    }
+    [[nodiscard]] auto operator==(const basic_iterator& rhs) const noexcept
+        -> bool {
+      return index == rhs.index;
+    }
+    [[nodiscard]] auto operator<=>(const basic_iterator& rhs) const noexcept {
+      return index <=> rhs.index;
+    }
+
+   private:
+    owner_type* owner = nullptr;
+    size_type index = 0;
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  StrongSoA() = default;
+  StrongSoA(const StrongSoA& other) {
+    reserve(other.size());
+    for (const auto source : other) {
+      std::apply([this](const Ts&... fields) { push_back(fields...); },
+                 source.values());
+    }
+  }
+  StrongSoA(StrongSoA&& other) noexcept
+      : columns{std::move(other.columns)},
+        count{std::exchange(other.count, 0)},
+        reserved{std::exchange(other.reserved, 0)} {}
+  auto operator=(StrongSoA other) noexcept -> StrongSoA& {
+    swap(other);
+    return *this;
+  }
+  ~StrongSoA() { clear(); }
+
+  void swap(StrongSoA& other) noexcept {
+    std::swap(columns, other.columns);
+    std::swap(count, other.count);
+    std::swap(reserved, other.reserved);
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return count; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return reserved;
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return count == 0; }
+
+  /**
+   * @brief Reserves every column for at least capacity rows
+   * @param capacity number of rows
+   */
+  void reserve(size_type capacity) {
+    if (capacity <= reserved) {
+      return;
+    }
+    std::tuple<strong::detail::ColumnPtr<Ts>...> grown{
+        strong::detail::allocateColumn<Ts>(capacity)...};
+    forEachColumn([&]<std::size_t index>() {
+      auto* from = std::get<index>(columns).get();
+      std::uninitialized_move_n(from, count, std::get<index>(grown).get());
+      std::destroy_n(from, count);
+    });
+    columns = std::move(grown);
+    reserved = capacity;
+  }
+  /**
+   * @brief Appends a row
+   * @param fields value of every column
+   */
+  void push_back(Ts... fields) {
+    if (count == reserved) {
+      reserve(std::max<size_type>(16, reserved * 2));
+    }
+    [&]<std::size_t... index>(std::index_sequence<index...>) {
+      (std::construct_at(std::get<index>(columns).get() + count,
+                         std::move(fields)),
+       ...);
+    }(std::index_sequence_for<Ts...>{});
+    ++count;
+  }
+  void pop_back() noexcept {
+    --count;
+    forEachColumn([&]<std::size_t index>() {
+      std::destroy_at(std::get<index>(columns).get() + count);
+    });
+  }
+  /**
+   * @brief Removes all rows, the capacity remains
+   */
+  void clear() noexcept {
+    forEachColumn([&]<std::size_t index>() {
+      std::destroy_n(std::get<index>(columns).get(), count);
+    });
+    count = 0;
+  }
+
+  [[nodiscard]] auto operator[](size_type index) noexcept -> row {
+    return {*this, index};
+  }
+  [[nodiscard]] auto operator[](size_type index) const noexcept -> const_row {
+    return {*this, index};
+  }
+  [[nodiscard]] auto begin() noexcept -> iterator { return {*this, 0}; }
+  [[nodiscard]] auto end() noexcept -> iterator { return {*this, count}; }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return {*this, 0};
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return {*this, count};
+  }
+
+  /**
+   * @brief Contiguous column at index
+   * @return span of the column
+   */
+  template <std::size_t index>
+    requires(index < sizeof...(Ts))
+  [[nodiscard]] auto column() noexcept -> std::span<column_type<index>> {
+    return {std::get<index>(columns).get(), count};
+  }
+  template <std::size_t index>
+    requires(index < sizeof...(Ts))
+  [[nodiscard]] auto column() const noexcept
+      -> std::span<const column_type<index>> {
+    return {std::get<index>(columns).get(), count};
+  }
+  /**
+   * @brief Contiguous column of type T, which must be unique in the container
+   * @return span of the column
+   */
+  template <typename T>
+    requires(strong::detail::indexOf<T, Ts...>() < sizeof...(Ts))
+  [[nodiscard]] auto column() noexcept -> std::span<T> {
+    return column<strong::detail::indexOf<T, Ts...>()>();
+  }
+  template <typename T>
+    requires(strong::detail::indexOf<T, Ts...>() < sizeof...(Ts))
+  [[nodiscard]] auto column() const noexcept -> std::span<const T> {
+    return column<strong::detail::indexOf<T, Ts...>()>();
+  }
+
+  /**
+   * @brief Order of the rows sorted by the column of Key, equal keys keep
+   * their order
+   * @param compare comparison of the keys
+   * @return row indices in sorted order
+   */
+  template <typename Key, typename Compare = std::less<>>
+    requires std::predicate<Compare&, const Key&, const Key&>
+  [[nodiscard]] auto order_by(Compare compare = {}) const
+      -> std::vector<size_type> {
+    std::vector<size_type> order(count);
+    const auto keys = column<Key>();
+    if constexpr (std::is_trivially_copyable_v<Key>) {
+      // sorting copies of the keys next to their row avoids a random access
+      // into the column for every comparison
+      std::vector<std::pair<Key, size_type>> sorted;
+      sorted.reserve(count);
+      for (size_type i = 0; i < count; ++i) {
+        sorted.emplace_back(keys[i], i);
+      }
+      std::stable_sort(sorted.begin(), sorted.end(),
+                       [&](const auto& lhs, const auto& rhs) {
+                         return compare(lhs.first, rhs.first);
+                       });
+      for (size_type i = 0; i < count; ++i) {
+        order[i] = sorted[i].second;
+      }
+    } else {
+      std::iota(order.begin(), order.end(), size_type{0});
+      std::stable_sort(order.begin(), order.end(),
+                       [&](size_type lhs, size_type rhs) {
+                         return compare(keys[lhs], keys[rhs]);
+                       });
+    }
+    return order;
+  }
+  /**
+   * @brief Sorts all columns by the column of Key, equal keys keep their order
+   * @param compare comparison of the keys
+   */
+  template <typename Key, typename Compare = std::less<>>
+    requires std::predicate<Compare&, const Key&, const Key&>
+  void sort_by(Compare compare = {}) {
+    permute(order_by<Key>(compare));
+  }
+  /**
+   * @brief Reorders all columns, row i becomes the former row order[i]
+   * @param order permutation of the row indices
+   * @throw std::invalid_argument if order isn't a permutation of the rows
+   */
+  void permute(std::span<const size_type> order) {
+    if (order.size() != count) {
+      throw std::invalid_argument{"StrongSoA: order needs one index per row"};
+    }
+    std::vector<bool> seen(count);
+    for (const auto row : order) {
+      if (row >= count || seen[row]) {
+        throw std::invalid_argument{"StrongSoA: order is no permutation"};
+      }
+      seen[row] = true;
+    }
+    std::tuple<strong::detail::ColumnPtr<Ts>...> permuted{
+        strong::detail::allocateColumn<Ts>(reserved)...};
+    forEachColumn([&]<std::size_t index>() {
+      auto* from = std::get<index>(columns).get();
+      auto* to = std::get<index>(permuted).get();
+      for (size_type i = 0; i < count; ++i) {
+        std::construct_at(to + i, std::move(from[order[i]]));
+      }
+      std::destroy_n(from, count);
+    });
+    columns = std::move(permuted);
+  }
+
+ private:
+  template <typename func>
+  void forEachColumn(func&& function) {
+    [&]<std::size_t... index>(std::index_sequence<index...>) {
+      (function.template operator()<index>(), ...);
+    }(std::index_sequence_for<Ts...>{});
+  }
+
+  std::tuple<strong::detail::ColumnPtr<Ts>...> columns;
+  size_type count = 0;
+  size_type reserved = 0;
+};
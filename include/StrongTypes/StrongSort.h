@@ -0,0 +1,352 @@
+#pragma once
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace strong {
+/**
+ * @brief Requests the multi threaded variant of strong::sort / stable_sort.
+ * std::execution::par needs TBB with libstdc++, so the sorts use their own
+ * worker threads instead
+ */
+struct parallel_policy {
+  /**
+   * @brief number of threads, 0 uses std::thread::hardware_concurrency()
+   */
+  std::size_t threads = 0;
+};
+inline constexpr parallel_policy par{};
+
+namespace detail {
+/**
+ * @brief Concept of the StrongTypes which are sorted by a LSD radix sort on
+ * their underlying value, the config has to enable ordering
+ */
+template <typename T>
+concept isRadixSortable =
+    isLayoutCompatibleStrongType<T> && isLessThenComparable<T> &&
+    ((std::is_integral_v<typename T::type> &&
+      !std::is_same_v<typename T::type, bool>) ||
+     (std::is_floating_point_v<typename T::type> &&
+      std::numeric_limits<typename T::type>::is_iec559 &&
+      (sizeof(typename T::type) == 4 || sizeof(typename T::type) == 8)));
+
+template <typename T>
+concept isSortableStrongType = isStrongType<T> && isLessThenComparable<T> &&
+                               std::is_move_constructible_v<T> &&
+                               std::is_move_assignable_v<T>;
+
+// below these sizes the setup of the radix passes or of the threads dominates
+inline constexpr std::size_t radixThreshold = 256;
+inline constexpr std::size_t minChunkPerThread = std::size_t{1} << 12;
+
+template <typename U>
+using radixKey = std::make_unsigned_t<
+    std::conditional_t<std::is_floating_point_v<U>,
+                       std::conditional_t<sizeof(U) == 4, std::int32_t,
+                                          std::int64_t>,
+                       U>>;
+
+/**
+ * @brief Unsigned key with the same order as the value, -0.0 maps to the key
+ * of 0.0 so the sort stays stable for values which compare equal
+ */
+template <typename U>
+[[nodiscard]] inline auto toRadixKey(U value) noexcept -> radixKey<U> {
+  using key = radixKey<U>;
+  constexpr key signBit = key{1} << (sizeof(key) * 8 - 1);
+  if constexpr (std::is_floating_point_v<U>) {
+    auto bits = std::bit_cast<key>(value);
+    if (bits == signBit) {
+      bits = 0;
+    }
+    return (bits & signBit) != 0 ? static_cast<key>(~bits) : bits | signBit;
+  } else if constexpr (std::is_signed_v<U>) {
+    return static_cast<key>(static_cast<key>(value) ^ signBit);
+  } else {
+    return static_cast<key>(value);
+  }
+}
+
+template <typename U>
+[[nodiscard]] inline auto digit(U value, std::size_t pass) noexcept
+    -> std::size_t {
+  return static_cast<std::size_t>((toRadixKey(value) >> (pass * 8)) & 0xff);
+}
+
+template <typename U>
+using histogram = std::array<std::array<std::size_t, 256>, sizeof(U)>;
+
+template <typename U>
+void countDigits(std::span<const U> values, histogram<U>& counts) noexcept {
+  for (const auto value : values) {
+    const auto key = toRadixKey(value);
+    for (std::size_t pass = 0; pass < sizeof(U); ++pass) {
+      ++counts[pass][static_cast<std::size_t>((key >> (pass * 8)) & 0xff)];
+    }
+  }
+}
+
+/**
+ * @brief Passes in which not all values share the same digit, the others
+ * would not move a single element
+ */
+template <typename U>
+[[nodiscard]] auto activePasses(const histogram<U>& counts, U first,
+                                std::size_t size) noexcept
+    -> std::array<bool, sizeof(U)> {
+  std::array<bool, sizeof(U)> active{};
+  for (std::size_t pass = 0; pass < sizeof(U); ++pass) {
+    active[pass] = counts[pass][digit(first, pass)] != size;
+  }
+  return active;
+}
+
+/**
+ * @brief LSD radix sort with 8 bit digits, stable
+ */
+template <typename U>
+void radixSort(std::span<U> values) {
+  histogram<U> counts{};
+  countDigits(std::span<const U>{values}, counts);
+  const auto active = activePasses(counts, values.front(), values.size());
+
+  auto scratch = std::make_unique_for_overwrite<U[]>(values.size());
+  U* src = values.data();
+  U* dst = scratch.get();
+  for (std::size_t pass = 0; pass < sizeof(U); ++pass) {
+    if (!active[pass]) {
+      continue;
+    }
+    std::array<std::size_t, 256> offsets;
+    std::size_t offset = 0;
+    for (std::size_t d = 0; d < 256; ++d) {
+      offsets[d] = offset;
+      offset += counts[pass][d];
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      dst[offsets[digit(src[i], pass)]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != values.data()) {
+    std::copy(src, src + values.size(), values.data());
+  }
+}
+
+/**
+ * @brief Multi threaded LSD radix sort. Every thread counts and scatters its
+ * own chunk, the chunks' offsets per digit follow the thread order, so the
+ * sort stays stable
+ */
+template <typename U>
+void parallelRadixSort(std::span<U> values, std::size_t threads) {
+  const auto size = values.size();
+  const auto chunk = (size + threads - 1) / threads;
+  const auto first = values.front();
+  auto scratch = std::make_unique_for_overwrite<U[]>(size);
+  std::vector<histogram<U>> allCounts(threads);
+  std::vector<std::array<std::size_t, 256>> counts(threads);
+  std::barrier sync{static_cast<std::ptrdiff_t>(threads)};
+
+  auto worker = [&](std::size_t thread) {
+    const auto begin = std::min(size, thread * chunk);
+    const auto end = std::min(size, begin + chunk);
+    allCounts[thread] = {};
+    countDigits(std::span<const U>{values.data() + begin, end - begin},
+                allCounts[thread]);
+    sync.arrive_and_wait();
+
+    histogram<U> total{};
+    for (const auto& other : allCounts) {
+      for (std::size_t pass = 0; pass < sizeof(U); ++pass) {
+        for (std::size_t d = 0; d < 256; ++d) {
+          total[pass][d] += other[pass][d];
+        }
+      }
+    }
+    const auto active = activePasses(total, first, size);
+
+    U* src = values.data();
+    U* dst = scratch.get();
+    for (std::size_t pass = 0; pass < sizeof(U); ++pass) {
+      if (!active[pass]) {
+        continue;
+      }
+      auto& own = counts[thread];
+      own.fill(0);
+      for (auto i = begin; i < end; ++i) {
+        ++own[digit(src[i], pass)];
+      }
+      sync.arrive_and_wait();
+
+      std::array<std::size_t, 256> offsets;
+      std::size_t offset = 0;
+      for (std::size_t d = 0; d < 256; ++d) {
+        for (std::size_t other = 0; other < threads; ++other) {
+          if (other == thread) {
+            offsets[d] = offset;
+          }
+          offset += counts[other][d];
+        }
+      }
+      for (auto i = begin; i < end; ++i) {
+        dst[offsets[digit(src[i], pass)]++] = src[i];
+      }
+      sync.arrive_and_wait();
+      std::swap(src, dst);
+    }
+    if (src != values.data()) {
+      std::copy(src + begin, src + end, values.data() + begin);
+    }
+  };
+
+  std::vector<std::jthread> workers;
+  workers.reserve(threads - 1);
+  for (std::size_t thread = 1; thread < threads; ++thread) {
+    workers.emplace_back(worker, thread);
+  }
+  worker(0);
+}
+
+/**
+ * @brief Sorts chunks in parallel and merges them pairwise
+ */
+template <bool stable, typename T>
+void parallelComparisonSort(std::span<T> values, std::size_t threads) {
+  const auto size = values.size();
+  const auto chunk = (size + threads - 1) / threads;
+  auto bound = [&](std::size_t index) {
+    return values.begin() + static_cast<std::ptrdiff_t>(
+                                std::min(size, index * chunk));
+  };
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&, thread] {
+        if constexpr (stable) {
+          std::stable_sort(bound(thread), bound(thread + 1), std::less<>{});
+        } else {
+          std::sort(bound(thread), bound(thread + 1), std::less<>{});
+        }
+      });
+    }
+  }
+  for (std::size_t width = 1; width < threads; width *= 2) {
+    std::vector<std::jthread> workers;
+    for (std::size_t first = 0; first + width < threads; first += 2 * width) {
+      workers.emplace_back([&, first, width] {
+        std::inplace_merge(bound(first), bound(first + width),
+                           bound(std::min(threads, first + 2 * width)),
+                           std::less<>{});
+      });
+    }
+  }
+}
+
+[[nodiscard]] inline auto threadCount(parallel_policy policy,
+                                      std::size_t size) noexcept
+    -> std::size_t {
+  auto threads = policy.threads != 0
+                     ? policy.threads
+                     : static_cast<std::size_t>(
+                           std::thread::hardware_concurrency());
+  return std::clamp<std::size_t>(size / minChunkPerThread, 1,
+                                 std::max<std::size_t>(threads, 1));
+}
+
+template <bool stable, typename T>
+void sortSpan(std::span<T> values) {
+  if constexpr (isRadixSortable<T>) {
+    if (values.size() >= radixThreshold) {
+      // a permutation keeps values with a validator valid
+      radixSort(underlyingView(values));
+      return;
+    }
+  }
+  if constexpr (stable) {
+    std::stable_sort(values.begin(), values.end(), std::less<>{});
+  } else {
+    std::sort(values.begin(), values.end(), std::less<>{});
+  }
+}
+
+template <bool stable, typename T>
+void sortSpan(parallel_policy policy, std::span<T> values) {
+  const auto threads = threadCount(policy, values.size());
+  if (threads == 1) {
+    sortSpan<stable>(values);
+  } else if constexpr (isRadixSortable<T>) {
+    parallelRadixSort(underlyingView(values), threads);
+  } else {
+    parallelComparisonSort<stable>(values, threads);
+  }
+}
+
+template <typename range>
+concept isSortableStrongRange =
+    std::ranges::contiguous_range<range> &&
+    !std::is_const_v<std::remove_reference_t<
+        std::ranges::range_reference_t<range>>> &&
+    isSortableStrongType<std::ranges::range_value_t<range>>;
+}  // namespace detail
+
+/**
+ * @brief Sorts StrongTypes ascending by operator<. Integral and floating point
+ * underlying types are sorted by a LSD radix sort on the underlying value, all
+ * others by std::sort. Only available if the config enables operator<
+ * @param values contiguous range of StrongTypes
+ */
+template <detail::isSortableStrongRange range>
+void sort(range&& values) {
+  detail::sortSpan<false>(
+      std::span<std::ranges::range_value_t<range>>{values});
+}
+/**
+ * @brief Multi threaded variant of strong::sort
+ * @param policy thread count
+ * @param values contiguous range of StrongTypes
+ */
+template <detail::isSortableStrongRange range>
+void sort(parallel_policy policy, range&& values) {
+  detail::sortSpan<false>(
+      policy, std::span<std::ranges::range_value_t<range>>{values});
+}
+/**
+ * @brief Sorts StrongTypes ascending by operator< and keeps the order of
+ * equal elements. Integral and floating point underlying types are sorted by a
+ * LSD radix sort, all others by std::stable_sort
+ * @param values contiguous range of StrongTypes
+ */
+template <detail::isSortableStrongRange range>
+void stable_sort(range&& values) {
+  detail::sortSpan<true>(
+      std::span<std::ranges::range_value_t<range>>{values});
+}
+/**
+ * @brief Multi threaded variant of strong::stable_sort
+ * @param policy thread count
+ * @param values contiguous range of StrongTypes
+ */
+template <detail::isSortableStrongRange range>
+void stable_sort(parallel_policy policy, range&& values) {
+  detail::sortSpan<true>(
+      policy, std::span<std::ranges::range_value_t<range>>{values});
+}
+}  // namespace strong
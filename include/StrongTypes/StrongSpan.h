@@ -0,0 +1,153 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+/**
+ * @brief Concept of a StrongType which has exactly the layout of its underlying
+ * type: stored as it, standard layout (so a derived class can't add members),
+ * same size and same alignment. Only those can be viewed as their underlying
+ * type
+ */
+template <typename T>
+concept isLayoutCompatibleStrongType =
+    isStrongType<T> && std::is_standard_layout_v<T> &&
+    std::is_same_v<typename T::storage_type, typename T::type> &&
+    sizeof(T) == sizeof(typename T::type) &&
+    alignof(T) == alignof(typename T::type);
+
+namespace strong {
+namespace detail {
+template <typename from, typename to>
+using copy_const_t =
+    std::conditional_t<std::is_const_v<from>, std::add_const_t<to>, to>;
+
+/**
+ * @brief Concept if a span of T may be viewed as its underlying values: a
+ * write through a mutable view would skip the validator, so only const spans
+ * of StrongTypes with checks on construction are viewable
+ */
+template <typename T>
+concept isUnderlyingViewable =
+    isLayoutCompatibleStrongType<std::remove_const_t<T>> &&
+    (std::is_const_v<T> ||
+     !isConstructionChecked<typename std::remove_const_t<T>::config_type>);
+
+// the views without the checks, for callers which keep every value valid,
+// e.g. sorting
+template <typename T, std::size_t extent>
+  requires isLayoutCompatibleStrongType<std::remove_const_t<T>>
+[[nodiscard]] auto underlyingView(std::span<T, extent> values) noexcept
+    -> std::span<copy_const_t<T, typename T::type>, extent> {
+  using underlying = copy_const_t<T, typename T::type>;
+  return std::span<underlying, extent>{
+      reinterpret_cast<underlying*>(values.data()), values.size()};
+}
+template <typename Strong, typename U, std::size_t extent>
+  requires isLayoutCompatibleStrongType<Strong> &&
+           std::is_same_v<std::remove_const_t<U>, typename Strong::type>
+[[nodiscard]] auto strongView(std::span<U, extent> values) noexcept
+    -> std::span<copy_const_t<U, Strong>, extent> {
+  using strong = copy_const_t<U, Strong>;
+  return std::span<strong, extent>{reinterpret_cast<strong*>(values.data()),
+                                   values.size()};
+}
+}  // namespace detail
+
+/**
+ * @brief Views a contiguous sequence of StrongTypes as their underlying values
+ * without copying. StrongTypes with a validator are only viewed as const
+ * @tparam T (const) StrongType
+ * @tparam extent extent of the span
+ * @param values strong values
+ * @return span of the underlying values
+ */
+template <typename T, std::size_t extent>
+  requires detail::isUnderlyingViewable<T>
+[[nodiscard]] auto as_underlying_span(std::span<T, extent> values) noexcept
+    -> std::span<detail::copy_const_t<T, typename T::type>, extent> {
+  return detail::underlyingView(values);
+}
+/**
+ * @brief Views a contiguous range of StrongTypes (e.g. a std::vector) as their
+ * underlying values without copying
+ * @param values strong values
+ * @return span of the underlying values
+ */
+template <std::ranges::contiguous_range range>
+  requires std::ranges::borrowed_range<range> &&
+           detail::isUnderlyingViewable<
+               std::remove_reference_t<std::ranges::range_reference_t<range>>>
+[[nodiscard]] auto as_underlying_span(range&& values) noexcept {
+  return as_underlying_span(std::span{values});
+}
+
+/**
+ * @brief Views a contiguous sequence of underlying values as StrongTypes
+ * without copying. StrongTypes with a validator need strong::unchecked
+ * @tparam Strong StrongType to view the values as
+ * @tparam U (const) underlying type of Strong
+ * @tparam extent extent of the span
+ * @param values underlying values
+ * @return span of the strong values
+ */
+template <typename Strong, typename U, std::size_t extent>
+  requires isLayoutCompatibleStrongType<Strong> &&
+           (!isConstructionChecked<typename Strong::config_type>) &&
+           std::is_same_v<std::remove_const_t<U>, typename Strong::type>
+[[nodiscard]] auto as_strong_span(std::span<U, extent> values) noexcept
+    -> std::span<detail::copy_const_t<U, Strong>, extent> {
+  return detail::strongView<Strong>(values);
+}
+/**
+ * @brief Views a contiguous range of underlying values (e.g. a std::vector) as
+ * StrongTypes without copying
+ * @tparam Strong StrongType to view the values as
+ * @param values underlying values
+ * @return span of the strong values
+ */
+template <typename Strong, std::ranges::contiguous_range range>
+  requires std::ranges::borrowed_range<range> &&
+           isLayoutCompatibleStrongType<Strong> &&
+           (!isConstructionChecked<typename Strong::config_type>) &&
+           std::is_same_v<std::ranges::range_value_t<range>,
+                          typename Strong::type>
+[[nodiscard]] auto as_strong_span(range&& values) noexcept {
+  return as_strong_span<Strong>(std::span{values});
+}
+/**
+ * @brief Views trusted underlying values as StrongTypes without running the
+ * validator, e.g. after strong::find_invalid checked them once
+ * @tparam Strong StrongType to view the values as
+ * @tparam U (const) underlying type of Strong
+ * @tparam extent extent of the span
+ * @param values underlying values, all of them must be valid
+ * @return span of the strong values
+ */
+template <typename Strong, typename U, std::size_t extent>
+  requires isLayoutCompatibleStrongType<Strong> &&
+           std::is_same_v<std::remove_const_t<U>, typename Strong::type>
+[[nodiscard]] auto as_strong_span(unchecked_t,
+                                  std::span<U, extent> values) noexcept
+    -> std::span<detail::copy_const_t<U, Strong>, extent> {
+  return detail::strongView<Strong>(values);
+}
+/**
+ * @brief Views a contiguous range of trusted underlying values as StrongTypes
+ * without running the validator
+ * @tparam Strong StrongType to view the values as
+ * @param values underlying values, all of them must be valid
+ * @return span of the strong values
+ */
+template <typename Strong, std::ranges::contiguous_range range>
+  requires std::ranges::borrowed_range<range> &&
+           isLayoutCompatibleStrongType<Strong> &&
+           std::is_same_v<std::ranges::range_value_t<range>,
+                          typename Strong::type>
+[[nodiscard]] auto as_strong_span(unchecked_t tag, range&& values) noexcept {
+  return as_strong_span<Strong>(tag, std::span{values});
+}
+}  // namespace strong
@@ -0,0 +1,335 @@
+#pragma once
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace strong {
+namespace detail {
+/**
+ * @brief Underlying types static_map can hash at compile time: integers,
+ * enums and text like strong::FixedString
+ */
+template <typename type>
+concept isStaticHashable =
+    std::is_integral_v<type> || std::is_enum_v<type> ||
+    std::is_convertible_v<const type&, std::string_view>;
+
+/**
+ * @brief Seeded hash of an underlying value, usable in constant expressions
+ * unlike std::hash
+ * @param value value to hash
+ * @param seed selects one of a family of hash functions
+ * @return hash value
+ */
+template <isStaticHashable type>
+[[nodiscard]] constexpr auto staticHash(const type& value,
+                                        std::uint64_t seed) noexcept
+    -> std::uint64_t {
+  constexpr std::uint64_t golden = 0x9e3779b97f4a7c15;
+  if constexpr (std::is_integral_v<type> || std::is_enum_v<type>) {
+    return mixHash(static_cast<std::uint64_t>(value) + seed * golden);
+  } else {
+    std::uint64_t hash = 0xcbf29ce484222325 ^ (seed * golden);
+    for (const char c : std::string_view{value}) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+    }
+    return mixHash(hash);
+  }
+}
+
+/**
+ * @brief Layout of an ordered static_map: the sorted keys in breadth first
+ * order of a complete binary tree (Eytzinger layout). The first levels of
+ * the search share cache lines and every step is a compare and an add
+ */
+template <typename Key, std::size_t N>
+struct EytzingerLayout {
+  // no table next to the keys
+  struct Table {};
+
+  /**
+   * @brief Order of the entries in the map
+   * @throw std::invalid_argument if a key is given twice
+   */
+  template <typename Entries>
+  [[nodiscard]] static constexpr auto build(const Entries& entries)
+      -> std::pair<std::array<std::size_t, N>, Table> {
+    std::array<std::size_t, N> sorted{};
+    for (std::size_t i = 0; i < N; ++i) {
+      sorted[i] = i;
+    }
+    std::sort(sorted.begin(), sorted.end(), [&](std::size_t a, std::size_t b) {
+      return entries[a].first < entries[b].first;
+    });
+    for (std::size_t i = 1; i < N; ++i) {
+      if (!(entries[sorted[i - 1]].first < entries[sorted[i]].first)) {
+        throw std::invalid_argument("static_map: duplicate key");
+      }
+    }
+    std::array<std::size_t, N> order{};
+    std::size_t next = 0;
+    fill(sorted, order, next, 1);
+    return {order, Table{}};
+  }
+  /**
+   * @brief Position of key or N, the loop has no branch on the keys
+   */
+  [[nodiscard]] static constexpr auto find(const std::array<Key, N>& keys,
+                                           const Table&,
+                                           const Key& key) noexcept
+      -> std::size_t {
+    std::size_t node = 1;
+    while (node <= N) {
+      node = 2 * node + static_cast<std::size_t>(keys[node - 1] < key);
+    }
+    // the right turns after the last left turn lead past the lower bound
+    node >>= std::countr_one(node) + 1;
+    if (node == 0 || key < keys[node - 1]) {
+      return N;
+    }
+    return node - 1;
+  }
+
+ private:
+  // in order traversal of the tree assigns the sorted keys
+  static constexpr void fill(const std::array<std::size_t, N>& sorted,
+                             std::array<std::size_t, N>& order,
+                             std::size_t& next, std::size_t node) {
+    if (node <= N) {
+      fill(sorted, order, next, 2 * node);
+      order[node - 1] = sorted[next++];
+      fill(sorted, order, next, 2 * node + 1);
+    }
+  }
+};
+
+/**
+ * @brief Layout of an unordered static_map: a perfect hash (hash and
+ * displace) over bit_ceil(N) slots. The first hash selects a bucket, the
+ * seed of the bucket a second hash, which is collision free for the keys
+ */
+template <typename Key, std::size_t N>
+struct PerfectHashLayout {
+  static constexpr std::size_t slotCount = std::bit_ceil(N);
+  static constexpr std::size_t mask = slotCount - 1;
+  static constexpr std::uint32_t maxSeed = 1u << 20;
+
+  struct Table {
+    std::array<std::uint32_t, slotCount> seeds{};
+    // entry of every slot, N if it is empty
+    std::array<std::uint32_t, slotCount> slots{};
+  };
+
+  /**
+   * @brief Order of the entries in the map and the seeds of the buckets
+   * @throw std::invalid_argument if a key is given twice
+   * @throw std::runtime_error if no seed separates the keys of a bucket
+   */
+  template <typename Entries>
+  [[nodiscard]] static constexpr auto build(const Entries& entries)
+      -> std::pair<std::array<std::size_t, N>, Table> {
+    std::array<std::size_t, N> order{};
+    std::array<std::size_t, N> buckets{};
+    std::array<std::size_t, slotCount> bucketSizes{};
+    for (std::size_t i = 0; i < N; ++i) {
+      order[i] = i;
+      buckets[i] = hash(entries[i].first, 0) & mask;
+      ++bucketSizes[buckets[i]];
+    }
+    // the largest buckets first, while most slots are free
+    std::array<std::size_t, N> byBucket = order;
+    std::sort(byBucket.begin(), byBucket.end(),
+              [&](std::size_t a, std::size_t b) {
+                if (bucketSizes[buckets[a]] != bucketSizes[buckets[b]]) {
+                  return bucketSizes[buckets[a]] > bucketSizes[buckets[b]];
+                }
+                return buckets[a] < buckets[b];
+              });
+
+    Table table;
+    table.slots.fill(static_cast<std::uint32_t>(N));
+    std::array<std::size_t, N> candidates{};
+    for (std::size_t first = 0; first < N;) {
+      const std::size_t bucket = buckets[byBucket[first]];
+      const std::size_t last = first + bucketSizes[bucket];
+      for (std::size_t i = first; i < last; ++i) {
+        for (std::size_t j = first; j < i; ++j) {
+          if (entries[byBucket[i]].first == entries[byBucket[j]].first) {
+            throw std::invalid_argument("static_map: duplicate key");
+          }
+        }
+      }
+      std::uint32_t seed = 1;
+      while (!place(entries, byBucket, first, last, seed, table.slots,
+                    candidates)) {
+        if (++seed == maxSeed) {
+          throw std::runtime_error("static_map: no perfect hash found");
+        }
+      }
+      table.seeds[bucket] = seed;
+      for (std::size_t i = first; i < last; ++i) {
+        table.slots[candidates[i]] = static_cast<std::uint32_t>(byBucket[i]);
+      }
+      first = last;
+    }
+    return {order, table};
+  }
+  /**
+   * @brief Position of key or N: two hashes, two loads and one compare
+   */
+  [[nodiscard]] static constexpr auto find(const std::array<Key, N>& keys,
+                                           const Table& table,
+                                           const Key& key) noexcept
+      -> std::size_t {
+    const auto seed = table.seeds[hash(key, 0) & mask];
+    const std::size_t index = table.slots[hash(key, seed) & mask];
+    if (index == N || !(keys[index] == key)) {
+      return N;
+    }
+    return index;
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto hash(const Key& key,
+                                           std::uint64_t seed) noexcept
+      -> std::size_t {
+    return static_cast<std::size_t>(staticHash(key.get(), seed));
+  }
+  // slots of the bucket for seed into candidates, false on a collision
+  template <typename Entries>
+  [[nodiscard]] static constexpr auto place(
+      const Entries& entries, const std::array<std::size_t, N>& byBucket,
+      std::size_t first, std::size_t last, std::uint32_t seed,
+      const std::array<std::uint32_t, slotCount>& slots,
+      std::array<std::size_t, N>& candidates) -> bool {
+    for (std::size_t i = first; i < last; ++i) {
+      const std::size_t slot = hash(entries[byBucket[i]].first, seed) & mask;
+      if (slots[slot] != N) {
+        return false;
+      }
+      for (std::size_t j = first; j < i; ++j) {
+        if (candidates[j] == slot) {
+          return false;
+        }
+      }
+      candidates[i] = slot;
+    }
+    return true;
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Concept of the keys of a static_map: ordered StrongTypes, or
+ * StrongTypes with operator== whose underlying value can be hashed at compile
+ * time
+ */
+template <typename Key>
+concept isStaticMapKey =
+    isStrongType<Key> &&
+    (isLessThenComparable<Key> ||
+     (isEqualComparable<Key> &&
+      detail::isStaticHashable<typename Key::type>));
+
+/**
+ * @brief Immutable map of a fixed set of StrongType constants, e.g. exchange
+ * ids to their names, built in a constant expression. A constexpr static_map
+ * is constant initialized, nothing runs at startup. Ordered configs are
+ * searched in an Eytzinger layout, configs with only operator== via a perfect
+ * hash of the underlying value
+ * @tparam Key StrongType, the config needs operator< (or <=>) or operator==
+ * @tparam Value mapped type, a literal type for a constexpr map
+ * @tparam N number of entries
+ */
+template <isStaticMapKey Key, typename Value, std::size_t N>
+  requires(N > 0)
+class static_map {
+  using layout =
+      std::conditional_t<isLessThenComparable<Key>,
+                         detail::EytzingerLayout<Key, N>,
+                         detail::PerfectHashLayout<Key, N>>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using size_type = std::size_t;
+
+  static constexpr bool is_ordered = isLessThenComparable<Key>;
+
+  /**
+   * @brief Builds the map, in a constant expression for a constexpr map
+   * @param entries keys and their values in any order
+   * @throw std::invalid_argument if a key is given twice, in a constant
+   * expression this is a compile error
+   */
+  constexpr explicit static_map(const std::array<value_type, N>& entries)
+      : static_map{entries, layout::build(entries),
+                   std::make_index_sequence<N>{}} {}
+
+  /**
+   * @brief Value of key
+   * @return pointer to the value or nullptr if key is no entry
+   */
+  [[nodiscard]] constexpr auto find(const Key& key) const noexcept
+      -> const Value* {
+    const auto index = layout::find(keys, table, key);
+    return index == N ? nullptr : &values[index];
+  }
+  [[nodiscard]] constexpr auto contains(const Key& key) const noexcept
+      -> bool {
+    return layout::find(keys, table, key) != N;
+  }
+  /**
+   * @brief Value of key
+   * @throw std::out_of_range if key is no entry
+   */
+  [[nodiscard]] constexpr auto at(const Key& key) const -> const Value& {
+    const auto* value = find(key);
+    if (value == nullptr) {
+      throw std::out_of_range("static_map: key not found");
+    }
+    return *value;
+  }
+  [[nodiscard]] static constexpr auto size() noexcept -> size_type {
+    return N;
+  }
+
+ private:
+  template <std::size_t... I>
+  constexpr static_map(
+      const std::array<value_type, N>& entries,
+      const std::pair<std::array<std::size_t, N>,
+                      typename layout::Table>& built,
+      std::index_sequence<I...>)
+      : keys{entries[built.first[I]].first...},
+        values{entries[built.first[I]].second...},
+        table{built.second} {}
+
+  std::array<Key, N> keys;
+  std::array<Value, N> values;
+  [[no_unique_address]] typename layout::Table table;
+};
+
+/**
+ * @brief Builds a static_map from a braced list, e.g.
+ * constexpr auto names = strong::make_static_map<ExchangeId,
+ * std::string_view>({{ExchangeId{1}, "XNAS"}, {ExchangeId{2}, "XNYS"}});
+ * @param entries keys and their values in any order
+ * @throw std::invalid_argument if a key is given twice
+ */
+template <typename Key, typename Value, std::size_t N>
+[[nodiscard]] constexpr auto make_static_map(
+    const std::pair<Key, Value> (&entries)[N]) -> static_map<Key, Value, N> {
+  return static_map<Key, Value, N>{std::to_array(entries)};
+}
+}  // namespace strong
@@ -1,6 +1,13 @@
 ﻿#pragma once
 #include <compare>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief Concept of a config structure for a strong type
@@ -24,6 +31,250 @@ concept isStrongTypeConfig = requires() {
   { config::allowUnderlyingTypeInOperator } -> std::convertible_to<bool>;
 };
 
+/**
+ * @brief Concept if the optional hash flag of a config is set. Configs without
+ * the flag don't get a std::hash specialization
+ */
+template <typename config>
+concept isHashEnabled = requires() {
+  { config::hash } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::hash);
+
+/**
+ * @brief Concept if the optional addSubtract flag of a config is set, enables
+ * +, - and negation between values of the same StrongType
+ */
+template <typename config>
+concept isAddSubtractEnabled = requires() {
+  { config::addSubtract } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::addSubtract);
+/**
+ * @brief Concept if the optional scale flag of a config is set, enables * and /
+ * with the underlying type
+ */
+template <typename config>
+concept isScaleEnabled = requires() {
+  { config::scale } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::scale);
+/**
+ * @brief Concept if the optional increment flag of a config is set, enables ++
+ * and --
+ */
+template <typename config>
+concept isIncrementEnabled = requires() {
+  { config::increment } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::increment);
+/**
+ * @brief Concept if the optional bitwise flag of a config is set, enables &, |,
+ * ^ and ~ between values of the same StrongType
+ */
+template <typename config>
+concept isBitwiseEnabled = requires() {
+  { config::bitwise } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::bitwise);
+
+/**
+ * @brief Concept if the config declares a validation policy via
+ * using validator = ...; whose static isValid(value) checks a value of the
+ * underlying type, e.g. strong::InRange<0, 100>
+ */
+template <typename config>
+concept isValidationEnabled = requires(
+    const std::remove_cvref_t<typename config::underlyingType>& value) {
+  typename config::validator;
+  { config::validator::isValid(value) } -> std::convertible_to<bool>;
+};
+/**
+ * @brief Concept if the validation policy of a config also sets the optional
+ * assume flag, then every value is known to be valid after construction and
+ * the compiler may rely on it. Only for trivially copyable underlying types,
+ * others may be left invalid by a move
+ */
+template <typename config>
+concept isAssumeEnabled =
+    isValidationEnabled<config> &&
+    std::is_trivially_copyable_v<typename config::underlyingType> &&
+    requires() {
+      { config::validator::assume } -> std::convertible_to<bool>;
+    } && static_cast<bool>(config::validator::assume);
+
+#if defined(__clang__)
+#define STRONGTYPES_ASSUME(condition) __builtin_assume(condition)
+#elif defined(_MSC_VER)
+#define STRONGTYPES_ASSUME(condition) __assume(condition)
+#else
+#define STRONGTYPES_ASSUME(condition) \
+  do {                                \
+    if (!(condition)) {               \
+      __builtin_unreachable();        \
+    }                                 \
+  } while (false)
+#endif
+
+namespace strong {
+/**
+ * @brief Tag type to construct a StrongType without running the validation
+ * policy of its config, e.g. for deserialization of trusted data
+ */
+struct unchecked_t {
+  explicit unchecked_t() = default;
+};
+inline constexpr unchecked_t unchecked{};
+
+/**
+ * @brief Validation policy for values within [minimum, maximum]
+ * @tparam minimum smallest valid value
+ * @tparam maximum largest valid value
+ */
+template <auto minimum, auto maximum>
+struct InRange {
+  static_assert(!(maximum < minimum), "empty range");
+  static constexpr auto min = minimum;
+  static constexpr auto max = maximum;
+  static constexpr bool assume = true;
+
+  template <typename T>
+  [[nodiscard]] static constexpr auto isValid(const T& value) noexcept
+      -> bool {
+    return value >= min && value <= max;
+  }
+};
+/**
+ * @brief Validation policy for containers and strings which must not be empty.
+ * Not assumed after construction, as a moved from value is empty
+ */
+struct NonEmpty {
+  template <typename T>
+  [[nodiscard]] static constexpr auto isValid(const T& value) noexcept(
+      noexcept(value.empty())) -> bool {
+    return !value.empty();
+  }
+};
+/**
+ * @brief Validation policy for a custom predicate, e.g.
+ * strong::Satisfies<[](int value) { return value % 2 == 0; }>. The predicate
+ * is not assumed after construction, as it could be expensive to evaluate
+ * @tparam predicate constexpr callable returning if a value is valid
+ */
+template <auto predicate>
+struct Satisfies {
+  template <typename T>
+  [[nodiscard]] static constexpr auto isValid(const T& value) noexcept(
+      noexcept(predicate(value))) -> bool {
+    return static_cast<bool>(predicate(value));
+  }
+};
+
+namespace detail {
+/**
+ * @brief Narrowest integer type which holds every value of [min, max]
+ */
+template <auto min, auto max>
+[[nodiscard]] consteval auto narrowestInteger() {
+  if constexpr (std::in_range<std::uint8_t>(min) &&
+                std::in_range<std::uint8_t>(max)) {
+    return std::type_identity<std::uint8_t>{};
+  } else if constexpr (std::in_range<std::int8_t>(min) &&
+                       std::in_range<std::int8_t>(max)) {
+    return std::type_identity<std::int8_t>{};
+  } else if constexpr (std::in_range<std::uint16_t>(min) &&
+                       std::in_range<std::uint16_t>(max)) {
+    return std::type_identity<std::uint16_t>{};
+  } else if constexpr (std::in_range<std::int16_t>(min) &&
+                       std::in_range<std::int16_t>(max)) {
+    return std::type_identity<std::int16_t>{};
+  } else if constexpr (std::in_range<std::uint32_t>(min) &&
+                       std::in_range<std::uint32_t>(max)) {
+    return std::type_identity<std::uint32_t>{};
+  } else if constexpr (std::in_range<std::int32_t>(min) &&
+                       std::in_range<std::int32_t>(max)) {
+    return std::type_identity<std::int32_t>{};
+  } else if constexpr (std::in_range<std::int64_t>(min) &&
+                       std::in_range<std::int64_t>(max)) {
+    return std::type_identity<std::int64_t>{};
+  } else {
+    return std::type_identity<std::uint64_t>{};
+  }
+}
+
+/**
+ * @brief Index of T in Ts, sizeof...(Ts) if it is missing and a larger value
+ * if it isn't unique
+ */
+template <typename T, typename... Ts>
+[[nodiscard]] consteval auto indexOf() -> std::size_t {
+  constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+  std::size_t index = sizeof...(Ts);
+  for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+    if (matches[i]) {
+      if (index != sizeof...(Ts)) {
+        return sizeof...(Ts) + 1;  // not unique
+      }
+      index = i;
+    }
+  }
+  return index;
+}
+}  // namespace strong::detail
+}  // namespace strong
+
+/**
+ * @brief Concept if the config declares the integer type to store the values
+ * in via using storageType = ...;
+ */
+template <typename config>
+concept isStorageDeclared = requires() { typename config::storageType; };
+/**
+ * @brief Concept if the optional compact flag of a config is set, then the
+ * values are stored in the narrowest integer which holds the range of the
+ * validator, e.g. strong::InRange<0, 1000> is stored in a std::uint16_t
+ */
+template <typename config>
+concept isCompactEnabled = requires() {
+  { config::compact } -> std::convertible_to<bool>;
+} && static_cast<bool>(config::compact);
+
+namespace strong::detail {
+template <typename config>
+struct storageOf {
+  using type = std::remove_cvref_t<typename config::underlyingType>;
+};
+template <typename config>
+  requires isStorageDeclared<config>
+struct storageOf<config> {
+  using type = typename config::storageType;
+};
+template <typename config>
+  requires(!isStorageDeclared<config> && isCompactEnabled<config>)
+struct storageOf<config> {
+  static_assert(
+      requires() {
+        config::validator::min;
+        config::validator::max;
+      }, "compact requires a range validator like strong::InRange");
+  using type = typename decltype(narrowestInteger<config::validator::min,
+                                                  config::validator::max>())::
+      type;
+};
+}  // namespace strong::detail
+
+/**
+ * @brief Concept if the values of a config are stored in another (narrower)
+ * integer than the underlying type, via storageType or compact
+ */
+template <typename config>
+concept isCompressionEnabled =
+    !std::is_same_v<typename strong::detail::storageOf<config>::type,
+                    std::remove_cvref_t<typename config::underlyingType>>;
+/**
+ * @brief Concept if constructing a value is checked, either by a validator or
+ * because it has to fit into the storage type. Such values can't be changed
+ * in place
+ */
+template <typename config>
+concept isConstructionChecked =
+    isValidationEnabled<config> || isCompressionEnabled<config>;
+
 /**
  * @brief Concept if 2 const objects are comparable via spaceship operator
  */
@@ -75,6 +326,47 @@ template <typename a, typename b = a>
 concept isLessEqualComparable = requires(const a& lhs, const b& rhs) {
   { lhs <= rhs } -> std::convertible_to<bool>;
 };
+/**
+ * @brief Concept if 2 objects can be added and subtracted
+ */
+template <typename a, typename b = a>
+concept isAddable = requires(a lhs, const b& rhs) {
+  lhs + rhs;
+  lhs - rhs;
+  lhs += rhs;
+  lhs -= rhs;
+};
+/**
+ * @brief Concept if 2 objects can be multiplied and divided
+ */
+template <typename a, typename b = a>
+concept isScalable = requires(a lhs, const b& rhs) {
+  lhs* rhs;
+  lhs / rhs;
+  lhs *= rhs;
+  lhs /= rhs;
+};
+/**
+ * @brief Concept if an object can be incremented and decremented
+ */
+template <typename a>
+concept isIncrementable = requires(a value) {
+  ++value;
+  --value;
+};
+/**
+ * @brief Concept if 2 objects support the bitwise operators
+ */
+template <typename a, typename b = a>
+concept isBitwiseCombinable = requires(a lhs, const b& rhs) {
+  lhs& rhs;
+  lhs | rhs;
+  lhs ^ rhs;
+  ~lhs;
+  lhs &= rhs;
+  lhs |= rhs;
+  lhs ^= rhs;
+};
 /**
  * @brief Class for a StrongType, can be used either as inheritance or
     composition if you want to extend this class via customization points!
@@ -85,29 +377,140 @@ class StrongType {
  public:
   // Removing any possible cvrefs
   using type = std::remove_cvref_t<typename config::underlyingType>;
+  using config_type = config;
+  // The type the value is stored in, the underlying type unless the config
+  // declares a narrower one. get() and the operators use the underlying type
+  using storage_type = typename strong::detail::storageOf<config>::type;
+  static_assert(std::is_same_v<storage_type, type> ||
+                    (std::is_integral_v<storage_type> &&
+                     std::is_integral_v<type>),
+                "a storage type is only supported for integers");
   // If the underlying type is smaller then a uintptr_t (assuming thats the size
-  // of a register, which probabbly isn't correct for NUMA architectures) this
-  // class will use copy instead of a const reference
-  using type_cref = typename std::
-      conditional_t<sizeof(type) >= sizeof(std::uintptr_t), const type&, type>;
+  // of a register, which probabbly isn't correct for NUMA architectures) and
+  // trivially copyable this class will use copy instead of a const reference.
+  // A compressed value is always returned by copy
+  using type_cref =
+      typename std::conditional_t<(sizeof(type) < sizeof(std::uintptr_t) &&
+                                   std::is_trivially_copyable_v<type>) ||
+                                      isCompressionEnabled<config>,
+                                  type, const type&>;
 
+  /**
+   * @brief Default Constructor, trivial if the underlying type has a trivial
+   * one. In that case the value is uninitialized like the underlying type.
+   * Not available with a validator, as the value could be invalid
+   */
+  StrongType()
+    requires(!isValidationEnabled<config>)
+  = default;
   /**
    * @brief Explicit Conversion Operator, no implicit conversion allowed so we
    * can retain the value of strong types
    * @param in current value
+   * @throw std::invalid_argument if the validator of the config rejects it
+   */
+  constexpr explicit StrongType(type_cref in) noexcept(
+      std::is_nothrow_copy_constructible_v<type> &&
+      !isValidationEnabled<config>)
+    requires std::is_copy_constructible_v<type> &&
+             (!isCompressionEnabled<config>)
+      : data{in} {
+    validate();
+  }
+  /**
+   * @brief Explicit Conversion Operator for values stored in a narrower type
+   * @param in current value
+   * @throw std::invalid_argument if the value doesn't fit the storage type or
+   * the validator of the config rejects it
+   */
+  constexpr explicit StrongType(type in)
+    requires isCompressionEnabled<config>
+      : data{narrow(in)} {
+    validate();
+  }
+  /**
+   * @brief Explicit Conversion Operator for temporaries, moves the value
+   * instead of copying it. Not needed if the value is passed by copy anyway
+   * @param in current value
+   * @throw std::invalid_argument if the validator of the config rejects it
+   */
+  constexpr explicit StrongType(type&& in) noexcept(
+      std::is_nothrow_move_constructible_v<type> &&
+      !isValidationEnabled<config>)
+    requires(!std::is_same_v<type_cref, type>)
+      : data{std::move(in)} {
+    validate();
+  }
+  /**
+   * @brief Constructs the underlying value in place from the given arguments
+   * @tparam ...Args Types of the constructor arguments of the underlying type
+   * @param ...args constructor arguments of the underlying type
+   * @throw std::invalid_argument if the validator of the config rejects it
+   */
+  template <typename... Args>
+    requires std::is_constructible_v<type, Args...> &&
+             (!isCompressionEnabled<config>)
+  constexpr explicit StrongType(std::in_place_t, Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<type, Args...> &&
+      !isValidationEnabled<config>)
+      : data(std::forward<Args>(args)...) {
+    validate();
+  }
+  /**
+   * @brief Takes over a value without validating it. The caller guarantees
+   * that it is valid, e.g. because it was validated in bulk before, and that
+   * it fits the storage type of a compressed config
+   * @param in current value
    */
-  explicit StrongType(type_cref in) : data{in} {}
+  constexpr StrongType(strong::unchecked_t, type_cref in) noexcept(
+      std::is_nothrow_copy_constructible_v<type>)
+    requires std::is_copy_constructible_v<type>
+      : data(static_cast<storage_type>(in)) {
+    if constexpr (isCompressionEnabled<config>) {
+      STRONGTYPES_ASSUME(std::in_range<storage_type>(in));
+    }
+  }
+  /**
+   * @brief Takes over a temporary without validating it
+   * @param in current value
+   */
+  constexpr StrongType(strong::unchecked_t, type&& in) noexcept(
+      std::is_nothrow_move_constructible_v<type>)
+    requires(!std::is_same_v<type_cref, type>)
+      : data{std::move(in)} {}
   /**
    * @brief Method to convert to the underlying value. This could be argued to
-   * be a cast in future or only the const overload
+   * be a cast in future or only the const overload. Not available with a
+   * validator, as the value could be changed to an invalid one
    * @return current value
    */
-  [[nodiscard]] auto get() noexcept -> type& { return data; }
+  [[nodiscard]] constexpr auto get() & noexcept -> type&
+    requires(!isConstructionChecked<config>)
+  {
+    return data;
+  }
   /**
    * @brief Retrieving the underlying value
    * @return current value
    */
-  [[nodiscard]] auto get() const noexcept -> type_cref { return data; }
+  [[nodiscard]] constexpr auto get() const& noexcept -> type_cref {
+    if constexpr (isAssumeEnabled<config>) {
+      STRONGTYPES_ASSUME(config::validator::isValid(load()));
+    }
+    return load();
+  }
+  /**
+   * @brief Moves the underlying value out of a temporary
+   * @return current value
+   */
+  [[nodiscard]] constexpr auto get() && noexcept(
+      std::is_nothrow_move_constructible_v<type>) -> type {
+    if constexpr (isCompressionEnabled<config>) {
+      return static_cast<type>(data);
+    } else {
+      return std::move(data);
+    }
+  }
 
 #pragma region Compare with StrongType<config>
   /**
@@ -121,7 +524,8 @@ class StrongType {
   template <typename otherType>
     requires std::is_same_v<StrongType<config>, otherType> &&
              config::spaceship && isSpaceshipComparable<type>
-  [[nodiscard]] auto operator<=>(const otherType& rhs) const noexcept {
+  [[nodiscard]] constexpr auto operator<=>(const otherType& rhs) const
+      noexcept(noexcept(this->data <=> rhs.data)) {
     return this->data <=> rhs.data;
   }
   /**
@@ -135,9 +539,10 @@ class StrongType {
   template <typename otherType>
     requires std::is_same_v<StrongType<config>, otherType> && config::equal &&
              isEqualComparable<type>
-  [[nodiscard]] auto operator==(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator==(const otherType& rhs) const
+      noexcept(noexcept(this->data == rhs.data)) -> bool {
     return this->data == rhs.data;
-  };
+  }
   /**
    * @brief Not Equal operator for comparision via StrongType<config>. This is
    * only a template to check the requirements. This function can be disabled
@@ -149,9 +554,10 @@ class StrongType {
   template <typename otherType>
     requires std::is_same_v<StrongType<config>, otherType> &&
              config::notEqual && isNotEqualComparable<type>
-  [[nodiscard]] auto operator!=(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator!=(const otherType& rhs) const
+      noexcept(noexcept(this->data != rhs.data)) -> bool {
     return this->data != rhs.data;
-  };
+  }
   /**
    * @brief Less then operator for comparision via StrongType<config>. This is
    * only a template to check the requirements. This function can be disabled
@@ -164,9 +570,10 @@ class StrongType {
     requires std::is_same_v<StrongType<config>, otherType> &&
              (config::lessThen && !config::spaceship) &&
              isLessThenComparable<type>
-  [[nodiscard]] auto operator<(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator<(const otherType& rhs) const
+      noexcept(noexcept(this->data < rhs.data)) -> bool {
     return this->data < rhs.data;
-  };
+  }
   /**
    * @brief Less or Equal then operator for comparision via StrongType<config>.
    * This is only a template to check the requirements. This can be disabled via
@@ -179,9 +586,10 @@ class StrongType {
     requires std::is_same_v<StrongType<config>, otherType> &&
              (config::lessEqual && !config::spaceship) &&
              isLessEqualComparable<type>
-  [[nodiscard]] auto operator<=(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator<=(const otherType& rhs) const
+      noexcept(noexcept(this->data <= rhs.data)) -> bool {
     return this->data <= rhs.data;
-  };
+  }
   /**
    * @brief Greater then operator for comparision via StrongType<config>. This
    * is only a template to check the requirements. This can be disabled via
@@ -194,9 +602,10 @@ class StrongType {
     requires std::is_same_v<StrongType<config>, otherType> &&
              (config::greaterThen && !config::spaceship) &&
              isGreaterThenComparable<type>
-  [[nodiscard]] auto operator>(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator>(const otherType& rhs) const
+      noexcept(noexcept(this->data > rhs.data)) -> bool {
     return this->data > rhs.data;
-  };
+  }
   /**
    * @brief Greater or equal then operator for comparision via
    * StrongType<config>. This is only a template to check the requirements. This
@@ -209,123 +618,675 @@ class StrongType {
     requires std::is_same_v<StrongType<config>, otherType> &&
              (config::greaterEqual && !config::spaceship) &&
              isGreaterEqualComparable<type>
-  [[nodiscard]] auto operator>=(const otherType& rhs) const -> bool {
+  [[nodiscard]] constexpr auto operator>=(const otherType& rhs) const
+      noexcept(noexcept(this->data >= rhs.data)) -> bool {
     return this->data >= rhs.data;
-  };
+  }
 #pragma endregion
-#pragma region Compare with underlying Type
-  /**
-   * @brief Spaceship operator for comparision via the underlying type. This is
-   * only a template to check the requirements. This function can be disabled
-   * via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::spaceship && config::allowUnderlyingTypeInOperator) &&
-             isSpaceshipComparable<type>
-  [[nodiscard]] auto operator<=>(const otherType& rhs) const noexcept {
-    return this->data <=> rhs.data;
+
+ private:
+  [[nodiscard]] static constexpr auto narrow(type in) -> storage_type {
+    if (!std::in_range<storage_type>(in)) {
+      throw std::invalid_argument{"StrongType: value exceeds storage type"};
+    }
+    return static_cast<storage_type>(in);
+  }
+  constexpr void validate() const {
+    if constexpr (isValidationEnabled<config>) {
+      if (!config::validator::isValid(load())) {
+        throw std::invalid_argument{"StrongType: value rejected by validator"};
+      }
+    }
   }
-  /**
-   * @brief Equal operator for comparision via the underlying type. This is
-   * only a template to check the requirements. This function can be disabled
-   * via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::equal && config::allowUnderlyingTypeInOperator) &&
-             isEqualComparable<type>
-  [[nodiscard]] auto operator==(const otherType& rhs) const -> bool {
-    return this->data == rhs;
-  };
-  /**
-   * @brief Not equal operator for comparision via the underlying type. This is
-   * only a template to check the requirements. This function can be disabled
-   * via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::notEqual && config::allowUnderlyingTypeInOperator) &&
-             isNotEqualComparable<type>
-  [[nodiscard]] auto operator!=(const otherType& rhs) const -> bool {
-    return this->data != rhs;
-  };
-  /**
-   * @brief Less then operator for comparision via the underlying type. This is
-   * only a template to check the requirements. This function can be disabled
-   * via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::lessThen && !config::spaceship &&
-              config::allowUnderlyingTypeInOperator) &&
-             isLessThenComparable<type>
-  [[nodiscard]] auto operator<(const otherType& rhs) const -> bool {
-    return this->data < rhs;
-  };
-  /**
-   * @brief Less or equal then operator for comparision via the underlying type.
-   * This is only a template to check the requirements. This function can be
-   * disabled via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::lessEqual && !config::spaceship &&
-              config::allowUnderlyingTypeInOperator) &&
-             isLessEqualComparable<type>
-  [[nodiscard]] auto operator<=(const otherType& rhs) const -> bool {
-    return this->data <= rhs;
-  };
 
+ protected:
   /**
-   * @brief Greater then operator for comparision via the underlying type. This
-   * is only a template to check the requirements. This function can be disabled
-   * via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
-   */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::greaterThen && !config::spaceship &&
-              config::allowUnderlyingTypeInOperator) &&
-             isGreaterThenComparable<type>
-  [[nodiscard]] auto operator>(const otherType& rhs) const -> bool {
-    return this->data > rhs;
-  };
-  /**
-   * @brief Greater or equal then operator for comparision via the underlying
-   * type. This is only a template to check the requirements. This function can
-   * be disabled via config!
-   * @tparam otherType Same as StrongType
-   * @param rhs Comparision object
-   * @return result of the comparision
+   * @brief The value as underlying type, without the assumption of get()
    */
-  template <typename otherType>
-    requires std::is_same_v<type, otherType> &&
-             (config::greaterEqual && !config::spaceship &&
-              config::allowUnderlyingTypeInOperator) &&
-             isGreaterEqualComparable<type>
-  [[nodiscard]] auto operator>=(const otherType& rhs) const -> bool {
-    return this->data >= rhs;
-  };
+  [[nodiscard]] constexpr auto load() const noexcept -> type_cref {
+    if constexpr (isCompressionEnabled<config>) {
+      return static_cast<type>(data);
+    } else {
+      return data;
+    }
+  }
+
+  storage_type data;
+};
+
+// The operators below are only declared once instead of in every StrongType,
+// so a StrongType doesn't pay for the operator sets its config leaves
+// disabled. They deduce the config from the StrongType, which keeps the
+// behaviour of member operators: the left operand may be derived from the
+// StrongType, the right one has to be the StrongType or its underlying type
+#pragma region Compare with underlying Type
+/**
+ * @brief Spaceship operator for comparision via the underlying type. This
+ * function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::spaceship && config::allowUnderlyingTypeInOperator) &&
+           isSpaceshipComparable<otherType>
+[[nodiscard]] constexpr auto operator<=>(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() <=> rhs)) {
+  return lhs.get() <=> rhs;
+}
+/**
+ * @brief Equal operator for comparision via the underlying type. This
+ * function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::equal && config::allowUnderlyingTypeInOperator) &&
+           isEqualComparable<otherType>
+[[nodiscard]] constexpr auto operator==(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() == rhs)) -> bool {
+  return lhs.get() == rhs;
+}
+/**
+ * @brief Not equal operator for comparision via the underlying type. This
+ * function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::notEqual && config::allowUnderlyingTypeInOperator) &&
+           isNotEqualComparable<otherType>
+[[nodiscard]] constexpr auto operator!=(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() != rhs)) -> bool {
+  return lhs.get() != rhs;
+}
+/**
+ * @brief Less then operator for comparision via the underlying type. This
+ * function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::lessThen && !config::spaceship &&
+            config::allowUnderlyingTypeInOperator) &&
+           isLessThenComparable<otherType>
+[[nodiscard]] constexpr auto operator<(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() < rhs)) -> bool {
+  return lhs.get() < rhs;
+}
+/**
+ * @brief Less or equal then operator for comparision via the underlying type.
+ * This function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::lessEqual && !config::spaceship &&
+            config::allowUnderlyingTypeInOperator) &&
+           isLessEqualComparable<otherType>
+[[nodiscard]] constexpr auto operator<=(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() <= rhs)) -> bool {
+  return lhs.get() <= rhs;
+}
+/**
+ * @brief Greater then operator for comparision via the underlying type. This
+ * function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::greaterThen && !config::spaceship &&
+            config::allowUnderlyingTypeInOperator) &&
+           isGreaterThenComparable<otherType>
+[[nodiscard]] constexpr auto operator>(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() > rhs)) -> bool {
+  return lhs.get() > rhs;
+}
+/**
+ * @brief Greater or equal then operator for comparision via the underlying
+ * type. This function can be disabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs StrongType
+ * @param rhs Comparision object
+ * @return result of the comparision
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           (config::greaterEqual && !config::spaceship &&
+            config::allowUnderlyingTypeInOperator) &&
+           isGreaterEqualComparable<otherType>
+[[nodiscard]] constexpr auto operator>=(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() >= rhs)) -> bool {
+  return lhs.get() >= rhs;
+}
 #pragma endregion
 
- protected:
-  type data;
+#pragma region Arithmetic
+/**
+ * @brief Addition of two StrongType<config>. This function has to be enabled
+ * via config!
+ * @tparam otherType Same as StrongType
+ * @param lhs summand
+ * @param rhs other summand
+ * @return sum
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isAddSubtractEnabled<config> &&
+           isAddable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator+(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(otherType{
+    static_cast<typename otherType::type>(lhs.get() + rhs.get())}))
+    -> otherType {
+  return otherType{
+      static_cast<typename otherType::type>(lhs.get() + rhs.get())};
+}
+/**
+ * @brief Subtraction of two StrongType<config>. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as StrongType
+ * @param lhs minuend
+ * @param rhs subtrahend
+ * @return difference
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isAddSubtractEnabled<config> &&
+           isAddable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator-(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(otherType{
+    static_cast<typename otherType::type>(lhs.get() - rhs.get())}))
+    -> otherType {
+  return otherType{
+      static_cast<typename otherType::type>(lhs.get() - rhs.get())};
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isAddSubtractEnabled<config> &&
+           isAddable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator+=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() += rhs.get()))
+    -> StrongType<config>& {
+  lhs.get() += rhs.get();
+  return lhs;
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isAddSubtractEnabled<config> &&
+           isAddable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator-=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() -= rhs.get()))
+    -> StrongType<config>& {
+  lhs.get() -= rhs.get();
+  return lhs;
+}
+/**
+ * @brief Negation, enabled together with addition and subtraction
+ * @param value value to negate
+ * @return negated value
+ */
+template <typename config>
+  requires isAddSubtractEnabled<config> &&
+           requires(typename StrongType<config>::type_cref value) { -value; }
+[[nodiscard]] constexpr auto operator-(
+    const StrongType<config>& value) noexcept(noexcept(StrongType<config>{
+        static_cast<typename StrongType<config>::type>(-value.get())}))
+    -> StrongType<config> {
+  return StrongType<config>{
+      static_cast<typename StrongType<config>::type>(-value.get())};
+}
+/**
+ * @brief Scales the value by the underlying type. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs value to scale
+ * @param rhs factor
+ * @return scaled value
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           isScaleEnabled<config> && isScalable<otherType>
+[[nodiscard]] constexpr auto operator*(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(StrongType<config>{
+    static_cast<otherType>(lhs.get() * rhs)})) -> StrongType<config> {
+  return StrongType<config>{static_cast<otherType>(lhs.get() * rhs)};
+}
+/**
+ * @brief Scales the value by the underlying type with the factor on the left
+ * hand side
+ * @tparam otherType Same as the underlying type
+ * @param lhs factor
+ * @param rhs value to scale
+ * @return scaled value
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           isScaleEnabled<config> && isScalable<otherType>
+[[nodiscard]] constexpr auto operator*(
+    const otherType& lhs,
+    const StrongType<config>& rhs) noexcept(noexcept(rhs * lhs))
+    -> StrongType<config> {
+  return rhs * lhs;
+}
+/**
+ * @brief Divides the value by the underlying type. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as the underlying type
+ * @param lhs value to scale
+ * @param rhs divisor
+ * @return scaled value
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           isScaleEnabled<config> && isScalable<otherType>
+[[nodiscard]] constexpr auto operator/(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(StrongType<config>{
+    static_cast<otherType>(lhs.get() / rhs)})) -> StrongType<config> {
+  return StrongType<config>{static_cast<otherType>(lhs.get() / rhs)};
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           isScaleEnabled<config> && isScalable<otherType> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator*=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() *= rhs))
+    -> StrongType<config>& {
+  lhs.get() *= rhs;
+  return lhs;
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<typename StrongType<config>::type, otherType> &&
+           isScaleEnabled<config> && isScalable<otherType> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator/=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() /= rhs))
+    -> StrongType<config>& {
+  lhs.get() /= rhs;
+  return lhs;
+}
+/**
+ * @brief Pre increment, has to be enabled via config
+ * @param value value to increment
+ * @return incremented value
+ */
+template <typename config>
+  requires isIncrementEnabled<config> &&
+           isIncrementable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator++(StrongType<config>& value) noexcept(
+    noexcept(++value.get())) -> StrongType<config>& {
+  ++value.get();
+  return value;
+}
+/**
+ * @brief Post increment, has to be enabled via config
+ * @param value value to increment
+ * @return previous value
+ */
+template <typename config>
+  requires isIncrementEnabled<config> &&
+           isIncrementable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator++(StrongType<config>& value, int) noexcept(
+    noexcept(++value.get()) &&
+    std::is_nothrow_copy_constructible_v<typename StrongType<config>::type>)
+    -> StrongType<config> {
+  auto previous = value;
+  ++value.get();
+  return previous;
+}
+/**
+ * @brief Pre decrement, has to be enabled via config
+ * @param value value to decrement
+ * @return decremented value
+ */
+template <typename config>
+  requires isIncrementEnabled<config> &&
+           isIncrementable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator--(StrongType<config>& value) noexcept(
+    noexcept(--value.get())) -> StrongType<config>& {
+  --value.get();
+  return value;
+}
+/**
+ * @brief Post decrement, has to be enabled via config
+ * @param value value to decrement
+ * @return previous value
+ */
+template <typename config>
+  requires isIncrementEnabled<config> &&
+           isIncrementable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator--(StrongType<config>& value, int) noexcept(
+    noexcept(--value.get()) &&
+    std::is_nothrow_copy_constructible_v<typename StrongType<config>::type>)
+    -> StrongType<config> {
+  auto previous = value;
+  --value.get();
+  return previous;
+}
+/**
+ * @brief Bitwise and of two StrongType<config>. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as StrongType
+ * @param lhs operand
+ * @param rhs other operand
+ * @return result of the operation
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator&(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(otherType{
+    static_cast<typename otherType::type>(lhs.get() & rhs.get())}))
+    -> otherType {
+  return otherType{
+      static_cast<typename otherType::type>(lhs.get() & rhs.get())};
+}
+/**
+ * @brief Bitwise or of two StrongType<config>. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as StrongType
+ * @param lhs operand
+ * @param rhs other operand
+ * @return result of the operation
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator|(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(otherType{
+    static_cast<typename otherType::type>(lhs.get() | rhs.get())}))
+    -> otherType {
+  return otherType{
+      static_cast<typename otherType::type>(lhs.get() | rhs.get())};
+}
+/**
+ * @brief Bitwise xor of two StrongType<config>. This function has to be
+ * enabled via config!
+ * @tparam otherType Same as StrongType
+ * @param lhs operand
+ * @param rhs other operand
+ * @return result of the operation
+ */
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator^(
+    const StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(otherType{
+    static_cast<typename otherType::type>(lhs.get() ^ rhs.get())}))
+    -> otherType {
+  return otherType{
+      static_cast<typename otherType::type>(lhs.get() ^ rhs.get())};
+}
+/**
+ * @brief Bitwise not, has to be enabled via config
+ * @param value value to invert
+ * @return inverted value
+ */
+template <typename config>
+  requires isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type>
+[[nodiscard]] constexpr auto operator~(
+    const StrongType<config>& value) noexcept(noexcept(StrongType<config>{
+        static_cast<typename StrongType<config>::type>(~value.get())}))
+    -> StrongType<config> {
+  return StrongType<config>{
+      static_cast<typename StrongType<config>::type>(~value.get())};
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator&=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() &= rhs.get()))
+    -> StrongType<config>& {
+  lhs.get() &= rhs.get();
+  return lhs;
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator|=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() |= rhs.get()))
+    -> StrongType<config>& {
+  lhs.get() |= rhs.get();
+  return lhs;
+}
+template <typename config, typename otherType>
+  requires std::is_same_v<StrongType<config>, otherType> &&
+           isBitwiseEnabled<config> &&
+           isBitwiseCombinable<typename StrongType<config>::type> &&
+           (!isConstructionChecked<config>)
+constexpr auto operator^=(
+    StrongType<config>& lhs,
+    const otherType& rhs) noexcept(noexcept(lhs.get() ^= rhs.get()))
+    -> StrongType<config>& {
+  lhs.get() ^= rhs.get();
+  return lhs;
+}
+#pragma endregion
+
+/**
+ * @brief Concept if T is a StrongType or derived from one
+ */
+template <typename T>
+concept isStrongType =
+    requires() { typename T::config_type; } &&
+    std::derived_from<T, StrongType<typename T::config_type>>;
+
+namespace strong {
+/**
+ * @brief Checked factory for StrongTypes with a validator, which reports an
+ * invalid value via an empty optional instead of an exception
+ * @tparam T StrongType
+ * @param value value to validate
+ * @return the StrongType if the value is valid
+ */
+template <isStrongType T>
+  requires isValidationEnabled<typename T::config_type>
+[[nodiscard]] constexpr auto makeChecked(const typename T::type& value)
+    -> std::optional<T> {
+  if (!T::config_type::validator::isValid(value)) {
+    return std::nullopt;
+  }
+  return T{unchecked, value};
+}
+/**
+ * @brief Checked factory for temporaries, moves the value if it is valid
+ */
+template <isStrongType T>
+  requires isValidationEnabled<typename T::config_type> &&
+           (!std::is_same_v<typename T::type_cref, typename T::type>)
+[[nodiscard]] constexpr auto makeChecked(typename T::type&& value)
+    -> std::optional<T> {
+  if (!T::config_type::validator::isValid(value)) {
+    return std::nullopt;
+  }
+  return T{unchecked, std::move(value)};
+}
+
+/**
+ * @brief Customization point for the result of lhs * rhs between 2 different
+ * StrongTypes, e.g. Price * Qty -> Notional. Specialize it with a member
+ * using type = result; to enable the operator
+ * @tparam lhs left StrongType
+ * @tparam rhs right StrongType
+ */
+template <typename lhs, typename rhs>
+struct multiplyResult {};
+/**
+ * @brief Customization point for the result of lhs / rhs between 2 different
+ * StrongTypes, e.g. Notional / Qty -> Price. Specialize it with a member
+ * using type = result; to enable the operator
+ * @tparam lhs left StrongType
+ * @tparam rhs right StrongType
+ */
+template <typename lhs, typename rhs>
+struct divideResult {};
+
+/**
+ * @brief Concept if the product of 2 StrongTypes has been declared and the
+ * product of their values converts to the underlying type of the result
+ */
+template <typename lhs, typename rhs>
+concept isMultipliable =
+    isStrongType<lhs> && isStrongType<rhs> &&
+    requires(const typename lhs::type& a, const typename rhs::type& b) {
+      typename multiplyResult<lhs, rhs>::type;
+      requires isStrongType<typename multiplyResult<lhs, rhs>::type>;
+      {
+        a* b
+      } -> std::convertible_to<typename multiplyResult<lhs, rhs>::type::type>;
+    };
+/**
+ * @brief Concept if the quotient of 2 StrongTypes has been declared and the
+ * quotient of their values converts to the underlying type of the result
+ */
+template <typename lhs, typename rhs>
+concept isDividable =
+    isStrongType<lhs> && isStrongType<rhs> &&
+    requires(const typename lhs::type& a, const typename rhs::type& b) {
+      typename divideResult<lhs, rhs>::type;
+      requires isStrongType<typename divideResult<lhs, rhs>::type>;
+      {
+        a / b
+      } -> std::convertible_to<typename divideResult<lhs, rhs>::type::type>;
+    };
+}  // namespace strong
+
+/**
+ * @brief Product of 2 different StrongTypes, only available if the result has
+ * been declared via strong::multiplyResult
+ * @param lhs left factor
+ * @param rhs right factor
+ * @return product as declared StrongType
+ */
+template <typename lhsType, typename rhsType>
+  requires strong::isMultipliable<lhsType, rhsType>
+[[nodiscard]] constexpr auto operator*(const lhsType& lhs,
+                                       const rhsType& rhs) noexcept(
+    noexcept(typename strong::multiplyResult<lhsType, rhsType>::type{
+        static_cast<
+            typename strong::multiplyResult<lhsType, rhsType>::type::type>(
+            lhs.get() * rhs.get())})) ->
+    typename strong::multiplyResult<lhsType, rhsType>::type {
+  using result = typename strong::multiplyResult<lhsType, rhsType>::type;
+  return result{static_cast<typename result::type>(lhs.get() * rhs.get())};
+}
+/**
+ * @brief Quotient of 2 different StrongTypes, only available if the result has
+ * been declared via strong::divideResult
+ * @param lhs dividend
+ * @param rhs divisor
+ * @return quotient as declared StrongType
+ */
+template <typename lhsType, typename rhsType>
+  requires strong::isDividable<lhsType, rhsType>
+[[nodiscard]] constexpr auto operator/(const lhsType& lhs,
+                                       const rhsType& rhs) noexcept(
+    noexcept(typename strong::divideResult<lhsType, rhsType>::type{
+        static_cast<
+            typename strong::divideResult<lhsType, rhsType>::type::type>(
+            lhs.get() / rhs.get())})) ->
+    typename strong::divideResult<lhsType, rhsType>::type {
+  using result = typename strong::divideResult<lhsType, rhsType>::type;
+  return result{static_cast<typename result::type>(lhs.get() / rhs.get())};
+}
+
+namespace strong {
+/**
+ * @brief Finalizer of a 64 bit value (murmur3 fmix64), spreads every input bit
+ * over the whole hash so sequential ids don't cluster in hash tables
+ * @param value value to mix
+ * @return hash value
+ */
+[[nodiscard]] constexpr auto mixHash(std::uint64_t value) noexcept
+    -> std::size_t {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return static_cast<std::size_t>(value);
+}
+/**
+ * @brief Hash of an underlying value. Integral types are mixed, every other
+ * type is forwarded to its std::hash
+ * @tparam type underlying type
+ * @param value value to hash
+ * @return hash value
+ */
+template <typename type>
+[[nodiscard]] constexpr auto hashValue(const type& value) noexcept(
+    std::is_integral_v<type> || std::is_enum_v<type> ||
+    noexcept(std::hash<type>{}(value))) -> std::size_t {
+  if constexpr (std::is_integral_v<type> || std::is_enum_v<type>) {
+    return mixHash(static_cast<std::uint64_t>(value));
+  } else {
+    return std::hash<type>{}(value);
+  }
+}
+}  // namespace strong
+
+namespace std {
+/**
+ * @brief Hash of a StrongType, only available if the config enables it
+ * @tparam config Configuration Structure of the StrongType
+ */
+template <isStrongTypeConfig config>
+  requires isHashEnabled<config>
+struct hash<StrongType<config>> {
+  [[nodiscard]] constexpr auto operator()(
+      const StrongType<config>& value) const
+      noexcept(noexcept(strong::hashValue(value.get()))) -> std::size_t {
+    return strong::hashValue(value.get());
+  }
 };
+}  // namespace std
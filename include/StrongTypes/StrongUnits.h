@@ -0,0 +1,311 @@
+#pragma once
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong {
+/**
+ * @brief Unit of a config, declared via
+ * using unit = strong::Unit<family, ratio>;
+ * StrongTypes of the same family convert into each other with strong_cast,
+ * e.g. Milliseconds with strong::Unit<Duration, std::milli> and Microseconds
+ * with strong::Unit<Duration, std::micro>
+ * @tparam family tag type shared by the related units
+ * @tparam ratio std::ratio of one unit to the base unit of the family
+ */
+template <typename family, typename ratio = std::ratio<1>>
+struct Unit {
+  static_assert(ratio::num > 0, "a unit needs a positive ratio");
+  using family_type = family;
+  using ratio_type = typename ratio::type;
+};
+}  // namespace strong
+
+/**
+ * @brief Concept if the config declares a unit via
+ * using unit = strong::Unit<family, ratio>;
+ */
+template <typename config>
+concept isUnitEnabled = requires() {
+  typename config::unit::family_type;
+  typename config::unit::ratio_type;
+};
+
+/**
+ * @brief Concept if From converts into To: both configs declare a unit of
+ * the same family and the underlying types are arithmetic. Floating point
+ * values don't convert into integers, as that would round silently
+ */
+template <typename From, typename To>
+concept isUnitConvertible =
+    isStrongType<From> && isStrongType<To> &&
+    isUnitEnabled<typename From::config_type> &&
+    isUnitEnabled<typename To::config_type> &&
+    std::is_same_v<typename From::config_type::unit::family_type,
+                   typename To::config_type::unit::family_type> &&
+    std::is_arithmetic_v<typename From::type> &&
+    std::is_arithmetic_v<typename To::type> &&
+    !std::is_same_v<typename From::type, bool> &&
+    !std::is_same_v<typename To::type, bool> &&
+    (std::is_floating_point_v<typename To::type> ||
+     std::is_integral_v<typename From::type>);
+
+namespace strong::detail {
+/**
+ * @brief Conversion of the underlying values of From into To: a value of From
+ * times num / den of the reduced ratio of both units. Integers are
+ * truncated towards zero like std::chrono::duration_cast
+ */
+template <typename From, typename To>
+  requires isUnitConvertible<From, To>
+struct UnitConversion {
+  using from_type = typename From::type;
+  using to_type = typename To::type;
+  using factor = std::ratio_divide<typename From::config_type::unit::ratio_type,
+                                   typename To::config_type::unit::ratio_type>;
+
+  static constexpr bool isFloating = std::is_floating_point_v<to_type>;
+  // integers are scaled in the widest integer of the signedness of From
+  using wide_type =
+      std::conditional_t<std::is_signed_v<from_type>, std::intmax_t,
+                         std::uintmax_t>;
+
+  /**
+   * @brief Converts a value, integers outside of [min, max] give a wrong
+   * result
+   */
+  [[nodiscard]] static constexpr auto apply(from_type value) noexcept
+      -> to_type {
+    if constexpr (isFloating) {
+      auto result = static_cast<to_type>(value);
+      if constexpr (factor::num != 1) {
+        result *= static_cast<to_type>(factor::num);
+      }
+      if constexpr (factor::den != 1) {
+        result /= static_cast<to_type>(factor::den);
+      }
+      return result;
+    } else {
+      auto result = static_cast<wide_type>(value);
+      if constexpr (factor::num != 1) {
+        // wraps instead of undefined behavior, convert checks afterwards
+        result = static_cast<wide_type>(
+            static_cast<std::uintmax_t>(result) *
+            static_cast<std::uintmax_t>(factor::num));
+      }
+      if constexpr (factor::den != 1) {
+        result /= static_cast<wide_type>(factor::den);
+      }
+      return static_cast<to_type>(result);
+    }
+  }
+
+  /**
+   * @brief If the product doesn't overflow and the result fits into To
+   */
+  [[nodiscard]] static constexpr auto fits(from_type value) noexcept
+      -> bool {
+    constexpr auto num = static_cast<wide_type>(factor::num);
+    constexpr auto den = static_cast<wide_type>(factor::den);
+    if (!std::in_range<wide_type>(value)) {
+      return false;
+    }
+    const auto wide = static_cast<wide_type>(value);
+    if (wide > std::numeric_limits<wide_type>::max() / num ||
+        wide < std::numeric_limits<wide_type>::min() / num) {
+      return false;
+    }
+    return std::in_range<to_type>(wide * num / den);
+  }
+
+  // the values which fit form a range around 0, as the conversion is
+  // monotonic, its bounds are searched at compile time
+  [[nodiscard]] static consteval auto searchMin() -> from_type {
+    if constexpr (isFloating) {
+      return std::numeric_limits<from_type>::lowest();
+    } else {
+      from_type low = std::numeric_limits<from_type>::lowest();
+      from_type high = 0;
+      while (low < high) {
+        const auto mid = std::midpoint(low, high);
+        if (fits(mid)) {
+          high = mid;
+        } else {
+          low = static_cast<from_type>(mid + 1);
+        }
+      }
+      return high;
+    }
+  }
+  [[nodiscard]] static consteval auto searchMax() -> from_type {
+    if constexpr (isFloating) {
+      return std::numeric_limits<from_type>::max();
+    } else {
+      from_type low = 0;
+      from_type high = std::numeric_limits<from_type>::max();
+      while (low < high) {
+        const auto mid = std::midpoint(high, low);
+        if (fits(mid)) {
+          low = mid;
+        } else {
+          high = static_cast<from_type>(mid - 1);
+        }
+      }
+      return low;
+    }
+  }
+
+  static constexpr from_type min = searchMin();
+  static constexpr from_type max = searchMax();
+  // if some values of From overflow To
+  static constexpr bool isChecked =
+      min != std::numeric_limits<from_type>::lowest() ||
+      max != std::numeric_limits<from_type>::max();
+};
+
+/**
+ * @brief Concept if convert may work on the underlying values directly:
+ * both types have the layout of their underlying type and To has no checks
+ * on construction
+ */
+template <typename From, typename To>
+concept isBulkUnitConvertible =
+    isLayoutCompatibleStrongType<From> && isLayoutCompatibleStrongType<To> &&
+    !isConstructionChecked<typename To::config_type>;
+
+/**
+ * @brief If the value of From converts into To without overflow
+ */
+template <typename From, typename To>
+[[nodiscard]] constexpr auto fitsUnit(typename From::type value) noexcept
+    -> bool {
+  using conversion = UnitConversion<From, To>;
+  if constexpr (conversion::isChecked) {
+    return value >= conversion::min && value <= conversion::max;
+  } else {
+    return true;
+  }
+}
+[[nodiscard]] inline auto convertOverflow(std::size_t offset)
+    -> std::overflow_error {
+  return std::overflow_error("convert: value at offset " +
+                             std::to_string(offset) + " overflows the target");
+}
+
+// values converted before their bounds are checked, so an overflow is found
+// while the chunk is still in the L1 cache
+inline constexpr std::size_t convertChunk = 1024;
+}  // namespace strong::detail
+
+namespace strong {
+/**
+ * @brief Converts a value into another unit of its family, e.g.
+ * strong::strong_cast<Microseconds>(Milliseconds{3}) is Microseconds{3000}.
+ * Integers are truncated towards zero, floating point targets follow IEEE
+ * arithmetic. In a constant expression an overflow is a compile error
+ * @tparam To StrongType to convert into
+ * @param value value to convert
+ * @throw std::overflow_error if an integer doesn't fit into To
+ * @throw std::invalid_argument if the validator of To rejects the result
+ */
+template <typename To, typename From>
+  requires isUnitConvertible<From, To>
+[[nodiscard]] constexpr auto strong_cast(const From& value) -> To {
+  const auto raw = static_cast<typename From::type>(value.get());
+  if (!detail::fitsUnit<From, To>(raw)) {
+    throw std::overflow_error("strong_cast: value overflows the target");
+  }
+  return To{detail::UnitConversion<From, To>::apply(raw)};
+}
+
+/**
+ * @brief strong_cast of every value. Types with the layout of their
+ * underlying type and without checks on construction are converted with a
+ * loop the compiler vectorizes, which tracks the bounds of the values of each
+ * chunk of 1024
+ * @param from values to convert
+ * @param to output, needs from.size() elements
+ * @throw std::invalid_argument if to is smaller than from
+ * @throw std::overflow_error with the offset of the first value which doesn't
+ * fit into To, the values of the chunks before it are converted
+ */
+template <typename From, typename To>
+  requires isUnitConvertible<From, To>
+void convert(std::span<const From> from, std::span<To> to) {
+  if (to.size() < from.size()) {
+    throw std::invalid_argument("convert: to is smaller than from");
+  }
+  if constexpr (detail::isBulkUnitConvertible<From, To>) {
+    using conversion = detail::UnitConversion<From, To>;
+    const auto in = as_underlying_span(from);
+    const auto out = as_underlying_span(to);
+    for (std::size_t i = 0; i < in.size(); i += detail::convertChunk) {
+      const auto chunk =
+          in.subspan(i, std::min(detail::convertChunk, in.size() - i));
+      // the bounds are tracked while converting, which keeps a single pass
+      auto low = conversion::min;
+      auto high = conversion::max;
+      for (std::size_t j = 0; j < chunk.size(); ++j) {
+        if constexpr (conversion::isChecked) {
+          low = std::min(low, chunk[j]);
+          high = std::max(high, chunk[j]);
+        }
+        out[i + j] = conversion::apply(chunk[j]);
+      }
+      if (low < conversion::min || high > conversion::max) {
+        const auto overflow =
+            std::ranges::find_if_not(chunk, detail::fitsUnit<From, To>);
+        throw detail::convertOverflow(
+            i + static_cast<std::size_t>(overflow - chunk.begin()));
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < from.size(); ++i) {
+      const auto raw = static_cast<typename From::type>(from[i].get());
+      if (!detail::fitsUnit<From, To>(raw)) {
+        throw detail::convertOverflow(i);
+      }
+      to[i] = To{detail::UnitConversion<From, To>::apply(raw)};
+    }
+  }
+}
+/**
+ * @brief strong_cast of every value
+ * @param from values to convert
+ * @return converted values
+ * @throw std::overflow_error with the offset of the first value which doesn't
+ * fit into To
+ */
+template <typename To, typename From>
+  requires isUnitConvertible<From, To>
+[[nodiscard]] auto convert(std::span<const From> from) -> std::vector<To> {
+  std::vector<To> to;
+  if constexpr (std::is_default_constructible_v<To>) {
+    to.resize(from.size());
+    convert(from, std::span{to});
+  } else {
+    // e.g. with a validator, every value is constructed in place
+    to.reserve(from.size());
+    for (std::size_t i = 0; i < from.size(); ++i) {
+      const auto raw = static_cast<typename From::type>(from[i].get());
+      if (!detail::fitsUnit<From, To>(raw)) {
+        throw detail::convertOverflow(i);
+      }
+      to.emplace_back(detail::UnitConversion<From, To>::apply(raw));
+    }
+  }
+  return to;
+}
+}  // namespace strong
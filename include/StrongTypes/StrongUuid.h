@@ -0,0 +1,385 @@
+#pragma once
+#include <StrongTypes/StrongSimd.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <array>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace strong {
+/**
+ * @brief 16 byte binary UUID in network byte order, trivially copyable. Use it
+ * as underlyingType of a StrongType (e.g. StrongUuid)
+ */
+struct Uuid {
+  std::array<std::uint8_t, 16> bytes{};
+
+  [[nodiscard]] friend constexpr auto operator==(const Uuid&,
+                                                 const Uuid&) noexcept
+      -> bool = default;
+  [[nodiscard]] friend constexpr auto operator<=>(const Uuid&,
+                                                  const Uuid&) noexcept
+      -> std::strong_ordering = default;
+
+  /**
+   * @brief Version nibble, 4 for random and 7 for time ordered UUIDs
+   */
+  [[nodiscard]] constexpr auto version() const noexcept -> int {
+    return bytes[6] >> 4;
+  }
+};
+
+}  // namespace strong
+
+namespace std {
+/**
+ * @brief Hash of both halves of a UUID
+ */
+template <>
+struct hash<strong::Uuid> {
+  [[nodiscard]] auto operator()(const strong::Uuid& uuid) const noexcept
+      -> std::size_t {
+    std::uint64_t high;
+    std::uint64_t low;
+    std::memcpy(&high, uuid.bytes.data(), 8);
+    std::memcpy(&low, uuid.bytes.data() + 8, 8);
+    return strong::mixHash(high ^ strong::mixHash(low));
+  }
+};
+}  // namespace std
+
+namespace strong {
+/**
+ * @brief Config of StrongUuid, ordered and hashable
+ */
+struct UuidConfig {
+  using underlyingType = Uuid;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+}  // namespace strong
+
+using StrongUuid = StrongType<strong::UuidConfig>;
+
+namespace strong {
+/**
+ * @brief Concept of StrongTypes over strong::Uuid
+ */
+template <typename T>
+concept isUuidStrongType =
+    isStrongType<T> && std::is_same_v<typename T::type, Uuid>;
+
+/**
+ * @brief Length of the canonical text form xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+ */
+inline constexpr std::size_t uuidTextSize = 36;
+
+namespace detail {
+[[nodiscard]] constexpr auto hexValue(char c) noexcept -> int {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+[[nodiscard]] constexpr auto isUuidDash(std::size_t position) noexcept
+    -> bool {
+  return position == 8 || position == 13 || position == 18 || position == 23;
+}
+
+[[nodiscard]] constexpr auto parseUuidScalar(const char* text,
+                                             Uuid& uuid) noexcept -> bool {
+  std::size_t nibble = 0;
+  for (std::size_t i = 0; i < uuidTextSize; ++i) {
+    if (isUuidDash(i)) {
+      if (text[i] != '-') {
+        return false;
+      }
+      continue;
+    }
+    const auto value = hexValue(text[i]);
+    if (value < 0) {
+      return false;
+    }
+    auto& byte = uuid.bytes[nibble / 2];
+    byte = static_cast<std::uint8_t>(nibble % 2 == 0 ? value << 4
+                                                     : byte | value);
+    ++nibble;
+  }
+  return true;
+}
+
+constexpr void formatUuidScalar(const Uuid& uuid, char* text) noexcept {
+  constexpr const char* digits = "0123456789abcdef";
+  std::size_t nibble = 0;
+  for (std::size_t i = 0; i < uuidTextSize; ++i) {
+    if (isUuidDash(i)) {
+      text[i] = '-';
+      continue;
+    }
+    const auto byte = uuid.bytes[nibble / 2];
+    text[i] = digits[nibble % 2 == 0 ? byte >> 4 : byte & 0xf];
+    ++nibble;
+  }
+}
+
+#if defined(STRONGTYPES_SSE42)
+// SSSE3 byte shuffles, which are part of every SSE4.2 target
+inline constexpr char zero = static_cast<char>(0x80);
+
+/**
+ * @brief Nibble values of 16 characters, lanes at dash positions have to be
+ * '-' and all others hex digits
+ */
+[[nodiscard]] inline auto hexNibbles(__m128i chars, int dashes,
+                                     bool& valid) noexcept -> __m128i {
+  const auto digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  const auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('/')),
+                                     _mm_cmplt_epi8(chars, _mm_set1_epi8(':')));
+  const auto lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+  const auto isLetter =
+      _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                    _mm_cmplt_epi8(lower, _mm_set1_epi8('g')));
+  const auto isDash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('-'));
+  const auto hex = _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+  valid = valid && (hex | dashes) == 0xffff &&
+          (_mm_movemask_epi8(isDash) & dashes) == dashes;
+  const auto letter = _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10));
+  return _mm_or_si128(_mm_and_si128(isDigit, digit),
+                      _mm_andnot_si128(isDigit, letter));
+}
+
+[[nodiscard]] inline auto parseUuidSimd(const char* text, Uuid& uuid) noexcept
+    -> bool {
+  const auto first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+  const auto second =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 16));
+  const auto last =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 20));
+  bool valid = true;
+  // dashes at 8, 13, 18 and 23 of the text
+  const auto a = hexNibbles(first, (1 << 8) | (1 << 13), valid);
+  const auto b = hexNibbles(second, (1 << 2) | (1 << 7), valid);
+  const auto c = hexNibbles(last, 1 << 3, valid);
+  if (!valid) {
+    return false;
+  }
+  // 32 nibbles without the dashes: text 0..17 and text 19..35
+  const auto low = _mm_or_si128(
+      _mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12,
+                                        14, 15, zero, zero)),
+      _mm_slli_si128(b, 14));
+  const auto high = _mm_or_si128(
+      _mm_shuffle_epi8(b, _mm_setr_epi8(3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14,
+                                        15, zero, zero, zero, zero)),
+      _mm_slli_si128(_mm_srli_si128(c, 12), 12));
+  // pairs of nibbles to bytes: high * 16 + low
+  const auto weights = _mm_set1_epi16(0x0110);
+  const auto bytes = _mm_packus_epi16(_mm_maddubs_epi16(low, weights),
+                                      _mm_maddubs_epi16(high, weights));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(uuid.bytes.data()), bytes);
+  return true;
+}
+
+inline void formatUuidSimd(const Uuid& uuid, char* text) noexcept {
+  const auto bytes =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(uuid.bytes.data()));
+  const auto mask = _mm_set1_epi8(0x0f);
+  const auto high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+  const auto low = _mm_and_si128(bytes, mask);
+  const auto digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const auto first =
+      _mm_shuffle_epi8(digits, _mm_unpacklo_epi8(high, low));  // hex 0..15
+  const auto second =
+      _mm_shuffle_epi8(digits, _mm_unpackhi_epi8(high, low));  // hex 16..31
+  const auto dash = _mm_set1_epi8('-');
+  // text 0..15 with dashes at 8 and 13
+  const auto out1 = _mm_or_si128(
+      _mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, zero, 8, 9,
+                                            10, 11, zero, 12, 13)),
+      _mm_and_si128(dash, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+                                        -1, 0, 0)));
+  // text 16..31 with dashes at 18 and 23
+  const auto out2 = _mm_or_si128(
+      _mm_or_si128(_mm_srli_si128(first, 14),
+                   _mm_shuffle_epi8(second,
+                                    _mm_setr_epi8(zero, zero, zero, 0, 1, 2, 3,
+                                                  zero, 4, 5, 6, 7, 8, 9, 10,
+                                                  11))),
+      _mm_and_si128(dash, _mm_setr_epi8(0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+                                        0, 0, 0, 0)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(text), out1);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(text + 16), out2);
+  const auto tail = _mm_cvtsi128_si32(_mm_srli_si128(second, 12));
+  std::memcpy(text + 32, &tail, 4);
+}
+#endif
+
+/**
+ * @brief xoshiro256** seeded per thread from std::random_device. Fast, but not
+ * meant for UUIDs which have to be unguessable
+ */
+class UuidRandom {
+ public:
+  UuidRandom() {
+    std::random_device device;
+    for (auto& word : state) {
+      word = (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+  }
+  [[nodiscard]] auto operator()() noexcept -> std::uint64_t {
+    const auto result = rotl(state[1] * 5, 7) * 9;
+    const auto t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+  }
+  [[nodiscard]] static auto local() -> UuidRandom& {
+    thread_local UuidRandom random;
+    return random;
+  }
+
+ private:
+  static constexpr auto rotl(std::uint64_t x, int k) noexcept
+      -> std::uint64_t {
+    return (x << k) | (x >> (64 - k));
+  }
+  std::array<std::uint64_t, 4> state{};
+};
+
+inline void storeBigEndian(std::uint8_t* out, std::uint64_t value) noexcept {
+  for (int i = 7; i >= 0; --i) {
+    out[i] = static_cast<std::uint8_t>(value);
+    value >>= 8;
+  }
+}
+
+inline auto withVersion(Uuid uuid, int version) noexcept -> Uuid {
+  uuid.bytes[6] = static_cast<std::uint8_t>((uuid.bytes[6] & 0x0f) |
+                                            (version << 4));
+  uuid.bytes[8] = static_cast<std::uint8_t>((uuid.bytes[8] & 0x3f) | 0x80);
+  return uuid;
+}
+}  // namespace detail
+
+/**
+ * @brief Parses the canonical text form, optionally enclosed in braces. A
+ * config of T with a validator is checked via strong::makeChecked, its
+ * isValid must not throw
+ * @tparam T StrongType over strong::Uuid
+ * @param text e.g. 01890a5d-ac96-774b-bcce-b302099a8057
+ * @return the UUID or std::nullopt if text is malformed or rejected by the
+ * validator of T
+ */
+template <isUuidStrongType T = StrongUuid>
+[[nodiscard]] auto parseUuid(std::string_view text) noexcept
+    -> std::optional<T> {
+  if (text.size() == uuidTextSize + 2 && text.front() == '{' &&
+      text.back() == '}') {
+    text = text.substr(1, uuidTextSize);
+  }
+  if (text.size() != uuidTextSize) {
+    return std::nullopt;
+  }
+  Uuid uuid;
+#if defined(STRONGTYPES_SSE42)
+  const bool valid = detail::parseUuidSimd(text.data(), uuid);
+#else
+  const bool valid = detail::parseUuidScalar(text.data(), uuid);
+#endif
+  if (!valid) {
+    return std::nullopt;
+  }
+  if constexpr (isValidationEnabled<typename T::config_type>) {
+    return makeChecked<T>(uuid);
+  } else {
+    return T{uuid};
+  }
+}
+
+/**
+ * @brief Writes the canonical lower case text form
+ * @param uuid StrongType over strong::Uuid
+ * @param text output of uuidTextSize characters, not null terminated
+ */
+template <isUuidStrongType T>
+void formatUuid(const T& uuid, std::span<char, uuidTextSize> text) noexcept {
+#if defined(STRONGTYPES_SSE42)
+  detail::formatUuidSimd(uuid.get(), text.data());
+#else
+  detail::formatUuidScalar(uuid.get(), text.data());
+#endif
+}
+
+/**
+ * @brief Canonical lower case text form
+ * @param uuid StrongType over strong::Uuid
+ * @return e.g. 01890a5d-ac96-774b-bcce-b302099a8057
+ */
+template <isUuidStrongType T>
+[[nodiscard]] auto toString(const T& uuid) -> std::string {
+  std::string text(uuidTextSize, '\0');
+  formatUuid(uuid, std::span<char, uuidTextSize>{text.data(), uuidTextSize});
+  return text;
+}
+
+/**
+ * @brief Random (version 4) UUID
+ */
+template <isUuidStrongType T = StrongUuid>
+[[nodiscard]] auto generateUuidV4() -> T {
+  auto& random = detail::UuidRandom::local();
+  Uuid uuid;
+  detail::storeBigEndian(uuid.bytes.data(), random());
+  detail::storeBigEndian(uuid.bytes.data() + 8, random());
+  return T{detail::withVersion(uuid, 4)};
+}
+
+/**
+ * @brief Time ordered (version 7) UUID: 48 bit unix milliseconds followed by
+ * random bits, so UUIDs of different milliseconds sort by creation time
+ */
+template <isUuidStrongType T = StrongUuid>
+[[nodiscard]] auto generateUuidV7() -> T {
+  auto& random = detail::UuidRandom::local();
+  const auto milliseconds = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  Uuid uuid;
+  detail::storeBigEndian(uuid.bytes.data(),
+                         (milliseconds << 16) | (random() & 0xffff));
+  detail::storeBigEndian(uuid.bytes.data() + 8, random());
+  return T{detail::withVersion(uuid, 7)};
+}
+
+}  // namespace strong
+
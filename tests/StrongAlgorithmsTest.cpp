@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongAlgorithms.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename T>
+struct OrderedConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+template <typename T>
+using Ordered = StrongType<OrderedConfig<T>>;
+
+struct HandleConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = false;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Handle = StrongType<HandleConfig>;
+
+template <typename T>
+concept isCountable = requires(std::span<const T> values, T value) {
+  strong::count_equal(values, value);
+};
+template <typename T>
+concept isSearchable = requires(std::span<const T> values, T value) {
+  strong::find_if_less(values, value);
+  strong::min_element(values);
+};
+
+static_assert(isCountable<Handle>);
+static_assert(!isSearchable<Handle>);
+static_assert(isSearchable<Ordered<std::string>>);
+
+namespace {
+template <typename T>
+auto randomValues(std::size_t count, std::uint32_t seed) -> std::vector<T> {
+  using type = typename T::type;
+  std::mt19937_64 random{seed};
+  std::vector<T> values;
+  values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    // a small value range, so there are duplicates to count and to tie on
+    values.emplace_back(
+        static_cast<type>(static_cast<int>(random() % 61) - 30));
+  }
+  return values;
+}
+
+template <typename T>
+auto scalarMask(const std::vector<T>& values, const T& pivot, auto compare)
+    -> std::vector<std::uint64_t> {
+  std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (compare(values[i], pivot)) {
+      mask[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+  }
+  return mask;
+}
+
+// sizes around the SIMD widths and the 64 lanes of a mask word
+constexpr std::size_t sizes[] = {0, 1, 3, 7, 16, 17, 63, 64, 65, 130, 1000};
+
+template <typename T>
+void compareWithScalar() {
+  for (const auto size : sizes) {
+    const auto values = randomValues<T>(size, static_cast<std::uint32_t>(size));
+    const std::span<const T> view{values};
+    for (const auto pivot : {T{-30}, T{0}, T{7}, T{31}}) {
+      ASSERT_EQ(strong::count_equal(view, pivot),
+                static_cast<std::size_t>(
+                    std::count(values.begin(), values.end(), pivot)));
+      ASSERT_EQ(strong::find_if_less(view, pivot) - view.begin(),
+                std::find_if(values.begin(), values.end(),
+                             [&](const T& v) { return v < pivot; }) -
+                    values.begin());
+      ASSERT_EQ(strong::find_if_greater(view, pivot) - view.begin(),
+                std::find_if(values.begin(), values.end(),
+                             [&](const T& v) { return v > pivot; }) -
+                    values.begin());
+      ASSERT_EQ(strong::compare_mask(view, pivot, std::less<>{}),
+                scalarMask(values, pivot, std::less<>{}));
+      ASSERT_EQ(strong::compare_mask(view, pivot, std::greater_equal<>{}),
+                scalarMask(values, pivot, std::greater_equal<>{}));
+      ASSERT_EQ(strong::compare_mask(view, pivot, std::not_equal_to<>{}),
+                scalarMask(values, pivot, std::not_equal_to<>{}));
+    }
+    ASSERT_EQ(strong::min_element(values) - view.begin(),
+              std::min_element(values.begin(), values.end()) - values.begin());
+    ASSERT_EQ(strong::max_element(values) - view.begin(),
+              std::max_element(values.begin(), values.end()) - values.begin());
+  }
+}
+}  // namespace
+
+TEST(StrongAlgorithms, int32) { compareWithScalar<Ordered<std::int32_t>>(); }
+TEST(StrongAlgorithms, int64) { compareWithScalar<Ordered<std::int64_t>>(); }
+TEST(StrongAlgorithms, float) { compareWithScalar<Ordered<float>>(); }
+TEST(StrongAlgorithms, double) { compareWithScalar<Ordered<double>>(); }
+TEST(StrongAlgorithms, int16) { compareWithScalar<Ordered<std::int16_t>>(); }
+
+TEST(StrongAlgorithms, unsigned_order) {
+  using Id = Ordered<std::uint64_t>;
+  std::vector<Id> ids(37, Id{5});
+  ids[20] = Id{std::numeric_limits<std::uint64_t>::max()};
+  ids[30] = Id{0};
+  const std::span<const Id> view{ids};
+  ASSERT_EQ(strong::find_if_greater(view, Id{5}) - view.begin(), 20);
+  ASSERT_EQ(strong::find_if_less(view, Id{5}) - view.begin(), 30);
+  ASSERT_EQ(strong::max_element(ids) - view.begin(), 20);
+  ASSERT_EQ(strong::min_element(ids) - view.begin(), 30);
+
+  using Small = Ordered<std::uint32_t>;
+  std::vector<Small> smalls(19, Small{1U << 31});
+  smalls[11] = Small{1};
+  const std::span<const Small> smallView{smalls};
+  ASSERT_EQ(strong::min_element(smallView) - smallView.begin(), 11);
+  ASSERT_EQ(strong::count_equal(smallView, Small{1U}), 1);
+}
+
+TEST(StrongAlgorithms, nan_and_signed_zero) {
+  using Value = Ordered<double>;
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<Value> values(21, Value{1.0});
+  values[3] = Value{nan};
+  values[9] = Value{0.0};
+  values[12] = Value{-0.0};
+  values[17] = Value{-2.0};
+  const std::span<const Value> view{values};
+  ASSERT_EQ(strong::count_equal(view, Value{nan}), 0);
+  ASSERT_EQ(strong::count_equal(view, Value{-0.0}), 2);
+  ASSERT_EQ(strong::find_if_less(view, Value{0.5}) - view.begin(), 9);
+  ASSERT_EQ(strong::min_element(values) - view.begin(), 17);
+  ASSERT_EQ(strong::max_element(values) - view.begin(), 0);
+
+  auto mask = strong::compare_mask(view, Value{1.0}, std::not_equal_to<>{});
+  ASSERT_EQ(mask[0], (1U << 3) | (1U << 9) | (1U << 12) | (1U << 17));
+
+  // like std::min_element a leading NaN wins
+  values[0] = Value{nan};
+  ASSERT_EQ(strong::min_element(values) - view.begin(), 0);
+  ASSERT_EQ(strong::max_element(values) - view.begin(), 0);
+}
+
+TEST(StrongAlgorithms, scalar_fallback) {
+  using Name = Ordered<std::string>;
+  std::vector<Name> names{Name{"b"}, Name{"a"}, Name{"c"}, Name{"a"}};
+  const std::span<const Name> view{names};
+  ASSERT_EQ(strong::count_equal(view, Name{"a"}), 2);
+  ASSERT_EQ(strong::find_if_less(view, Name{"b"}) - view.begin(), 1);
+  ASSERT_EQ(strong::min_element(names) - view.begin(), 1);
+  ASSERT_EQ(strong::max_element(names) - view.begin(), 2);
+  ASSERT_EQ(strong::compare_mask(view, Name{"b"}, std::less<>{}).front(),
+            0b1010);
+
+  std::vector<Handle> handles{Handle{1}, Handle{2}, Handle{1}};
+  ASSERT_EQ(strong::count_equal(std::span<const Handle>{handles}, Handle{1}),
+            2);
+}
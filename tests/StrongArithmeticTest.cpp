@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+struct PriceConfig {
+  using underlyingType = double;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+
+  static constexpr bool addSubtract = true;
+  static constexpr bool scale = true;
+};
+using Price = StrongType<PriceConfig>;
+
+struct QtyConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+
+  static constexpr bool addSubtract = true;
+  static constexpr bool scale = true;
+  static constexpr bool increment = true;
+};
+using Qty = StrongType<QtyConfig>;
+
+struct NotionalConfig {
+  using underlyingType = double;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+
+  static constexpr bool addSubtract = true;
+};
+using Notional = StrongType<NotionalConfig>;
+
+struct FlagsConfig {
+  using underlyingType = std::uint8_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+
+  static constexpr bool bitwise = true;
+};
+using Flags = StrongType<FlagsConfig>;
+
+template <>
+struct strong::multiplyResult<Price, Qty> {
+  using type = Notional;
+};
+template <>
+struct strong::divideResult<Notional, Qty> {
+  using type = Price;
+};
+
+// a declared result with a validator
+struct LotsConfig : QtyConfig {};
+using Lots = StrongType<LotsConfig>;
+struct SmallNotionalConfig : NotionalConfig {
+  using validator = strong::InRange<0.0, 100.0>;
+};
+using SmallNotional = StrongType<SmallNotionalConfig>;
+struct SmallPriceConfig : PriceConfig {
+  using validator = strong::InRange<0.0, 10.0>;
+};
+using SmallPrice = StrongType<SmallPriceConfig>;
+
+template <>
+struct strong::multiplyResult<Price, Lots> {
+  using type = SmallNotional;
+};
+template <>
+struct strong::divideResult<SmallNotional, Lots> {
+  using type = SmallPrice;
+};
+
+template <typename a, typename b = a>
+concept isAddableStrong = requires(const a& lhs, const b& rhs) {
+  { lhs + rhs } -> std::same_as<a>;
+};
+template <typename a, typename b>
+concept isMultipliableWith = requires(const a& lhs, const b& rhs) {
+  lhs* rhs;
+};
+
+static_assert(isAddableStrong<Price>);
+static_assert(!isAddableStrong<Price, Qty>);
+static_assert(!isAddableStrong<Price, double>);
+static_assert(!isAddableStrong<Flags>);
+static_assert(!isIncrementable<Price>);
+static_assert(isIncrementable<Qty>);
+static_assert(!isBitwiseCombinable<Qty>);
+static_assert(isBitwiseCombinable<Flags>);
+static_assert(isMultipliableWith<Price, double>);
+static_assert(!isMultipliableWith<Price, float>);
+static_assert(!isMultipliableWith<Price, Price>);
+static_assert(!isMultipliableWith<Qty, Price>);
+static_assert(!isMultipliableWith<Notional, double>);
+static_assert(std::is_same_v<decltype(Price{1.0} * Qty{2}), Notional>);
+static_assert(std::is_same_v<decltype(Notional{1.0} / Qty{2}), Price>);
+static_assert(noexcept(Price{1.0} + Price{2.0}));
+static_assert(noexcept(Price{1.0} * Qty{2}));
+static_assert(!noexcept(Price{1.0} * Lots{2}));
+static_assert(!noexcept(SmallNotional{1.0} / Lots{2}));
+static_assert(noexcept(++std::declval<Qty&>()));
+
+static_assert((Price{1.5} + Price{2.5}).get() == 4.0);
+static_assert((Price{1.5} - Price{2.5}).get() == -1.0);
+static_assert((-Price{1.5}).get() == -1.5);
+static_assert((Price{1.5} * 2.0).get() == 3.0);
+static_assert((2.0 * Price{1.5}).get() == 3.0);
+static_assert((Price{3.0} / 2.0).get() == 1.5);
+static_assert((Price{2.5} * Qty{4}).get() == 10.0);
+static_assert((Notional{10.0} / Qty{4}).get() == 2.5);
+static_assert((Flags{0b0110} & Flags{0b0011}).get() == 0b0010);
+static_assert((Flags{0b0110} | Flags{0b0011}).get() == 0b0111);
+static_assert((Flags{0b0110} ^ Flags{0b0011}).get() == 0b0101);
+static_assert((~Flags{0b0000'1111}).get() == 0b1111'0000);
+static_assert([] {
+  Qty qty{1};
+  qty += Qty{2};
+  qty -= Qty{1};
+  qty *= std::int64_t{3};
+  qty /= std::int64_t{2};
+  ++qty;
+  qty++;
+  --qty;
+  return (qty--).get() * 10 + qty.get();
+}() == 43);
+
+// the operators deduce the config, so a type derived from a StrongType keeps
+// them on the left hand side
+struct LotQty : Qty {
+  using Qty::Qty;
+};
+static_assert((LotQty{2} + Qty{3}).get() == 5);
+static_assert((LotQty{2} * std::int64_t{3}).get() == 6);
+static_assert((std::int64_t{3} * LotQty{2}).get() == 6);
+static_assert([] {
+  LotQty lots{1};
+  lots += Qty{2};
+  ++lots;
+  return lots.get();
+}() == 4);
+
+TEST(Arithmetic, compound_flags) {
+  Flags flags{0b0001};
+  flags |= Flags{0b0100};
+  ASSERT_EQ(flags.get(), 0b0101);
+  flags &= Flags{0b0100};
+  ASSERT_EQ(flags.get(), 0b0100);
+  flags ^= Flags{0b1100};
+  ASSERT_EQ(flags.get(), 0b1000);
+}
+
+TEST(Arithmetic, notional) {
+  const Price price{12.5};
+  Notional total{0.0};
+  for (Qty qty{1}; qty <= Qty{4}; ++qty) {
+    total += price * qty;
+  }
+  ASSERT_EQ(total, Notional{125.0});
+  ASSERT_EQ(total / Qty{10}, price);
+}
+
+TEST(Arithmetic, validated_result) {
+  ASSERT_EQ((Price{2.0} * Lots{50}).get(), 100.0);
+  ASSERT_THROW(static_cast<void>(Price{50.0} * Lots{50}),
+               std::invalid_argument);
+  ASSERT_EQ((SmallNotional{100.0} / Lots{10}).get(), 10.0);
+  ASSERT_THROW(static_cast<void>(SmallNotional{100.0} / Lots{1}),
+               std::invalid_argument);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongAtomic.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+struct SequenceConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool addSubtract = true;
+};
+using Sequence = StrongType<SequenceConfig>;
+
+struct LevelConfig : SequenceConfig {
+  static constexpr bool addSubtract = false;
+  using validator = strong::InRange<0, 10>;
+};
+using Level = StrongType<LevelConfig>;
+
+struct StateConfig {
+  using underlyingType = std::uint8_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using State = StrongType<StateConfig>;
+
+template <typename T>
+concept hasFetchAdd = requires(T atomic, typename T::value_type value) {
+  atomic.fetch_add(value);
+};
+template <typename T>
+concept hasFetchMax = requires(T atomic, typename T::value_type value) {
+  atomic.fetch_max(value);
+};
+
+static_assert(hasFetchAdd<StrongAtomic<SequenceConfig>>);
+static_assert(!hasFetchAdd<StrongAtomic<LevelConfig>>);
+static_assert(!hasFetchAdd<StrongAtomic<StateConfig>>);
+static_assert(hasFetchMax<StrongAtomic<LevelConfig>>);
+static_assert(!hasFetchMax<StrongAtomic<StateConfig>>);
+static_assert(StrongAtomic<SequenceConfig>::is_always_lock_free);
+// zero is not a valid value of every validator, like StrongType itself
+static_assert(std::is_default_constructible_v<StrongAtomic<SequenceConfig>>);
+static_assert(!std::is_default_constructible_v<StrongAtomic<LevelConfig>>);
+static_assert(
+    !std::is_default_constructible_v<StrongPaddedAtomic<LevelConfig>>);
+static_assert(sizeof(StrongAtomic<StateConfig>) == 1);
+static_assert(sizeof(StrongPaddedAtomic<SequenceConfig>) ==
+              strong::cacheLineSize);
+static_assert(alignof(StrongPaddedAtomic<StateConfig>) ==
+              strong::cacheLineSize);
+
+TEST(StrongAtomic, load_store_exchange) {
+  StrongAtomic<StateConfig> state{State{1}};
+  ASSERT_EQ(state.load(), State{1});
+  state.store(State{2});
+  ASSERT_EQ(state.exchange(State{3}), State{2});
+
+  auto expected = State{1};
+  ASSERT_FALSE(state.compare_exchange_strong(expected, State{4}));
+  ASSERT_EQ(expected, State{3});
+  ASSERT_TRUE(state.compare_exchange_strong(expected, State{4}));
+  ASSERT_EQ(state.load(), State{4});
+}
+
+TEST(StrongAtomic, fetch_add_and_max) {
+  StrongAtomic<SequenceConfig> sequence;
+  ASSERT_EQ(sequence.fetch_add(Sequence{5}), Sequence{0});
+  ASSERT_EQ(sequence.fetch_sub(Sequence{2}), Sequence{5});
+  ASSERT_EQ(sequence.fetch_max(Sequence{1}), Sequence{3});
+  ASSERT_EQ(sequence.load(), Sequence{3});
+  ASSERT_EQ(sequence.fetch_max(Sequence{7}), Sequence{3});
+  ASSERT_EQ(sequence.fetch_min(Sequence{-1}), Sequence{7});
+  ASSERT_EQ(sequence.load(), Sequence{-1});
+
+  StrongAtomic<LevelConfig> level{Level{4}};
+  ASSERT_EQ(level.fetch_max(Level{9}), Level{4});
+  ASSERT_EQ(level.load(), Level{9});
+}
+
+TEST(StrongAtomic, concurrent_updates) {
+  constexpr int perThread = 10000;
+  StrongAtomic<SequenceConfig> sum;
+  StrongAtomic<SequenceConfig> highWaterMark;
+  StrongShardedCounter<SequenceConfig> counter{4};
+  ASSERT_EQ(counter.shardCount(), 4);
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 8; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < perThread; ++i) {
+          sum.fetch_add(Sequence{1}, std::memory_order_relaxed);
+          highWaterMark.fetch_max(Sequence{t * perThread + i});
+          counter.add(Sequence{2});
+        }
+      });
+    }
+  }
+  ASSERT_EQ(sum.load(), Sequence{8 * perThread});
+  ASSERT_EQ(highWaterMark.load(), Sequence{8 * perThread - 1});
+  ASSERT_EQ(counter.load(), Sequence{16 * perThread});
+  counter.sub(Sequence{5});
+  ASSERT_EQ(counter.load(), Sequence{16 * perThread - 5});
+  counter.reset();
+  ASSERT_EQ(counter.load(), Sequence{0});
+  ASSERT_EQ(StrongShardedCounter<SequenceConfig>{3}.shardCount(), 4);
+}
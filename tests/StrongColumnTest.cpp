@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongColumn.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+struct StoredIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using StoredId = StrongType<StoredIdConfig>;
+// same underlying type, but another StrongType
+struct OtherIdConfig : StoredIdConfig {};
+using OtherId = StrongType<OtherIdConfig>;
+struct PinnedIdConfig : StoredIdConfig {
+  static constexpr std::uint64_t fingerprint = 42;
+};
+using PinnedId = StrongType<PinnedIdConfig>;
+struct SmallLevelConfig : StoredIdConfig {
+  using underlyingType = int;
+  using validator = strong::InRange<0, 200>;
+  static constexpr bool compact = true;
+};
+using SmallLevel = StrongType<SmallLevelConfig>;
+struct BoundedIdConfig : StoredIdConfig {
+  using validator = strong::InRange<0, 1'000'000>;
+};
+using BoundedId = StrongType<BoundedIdConfig>;
+
+static_assert(strong::configFingerprint<StoredIdConfig>() !=
+              strong::configFingerprint<OtherIdConfig>());
+static_assert(strong::configFingerprint<PinnedIdConfig>() == 42);
+static_assert(isColumnStrongType<StoredId>);
+static_assert(isColumnStrongType<BoundedId>);
+static_assert(isColumnStrongType<SmallLevel>);
+
+namespace {
+class StrongColumnFile : public testing::Test {
+ protected:
+  void TearDown() override { std::filesystem::remove(path); }
+
+  std::filesystem::path path = std::filesystem::temp_directory_path() /
+                               "StrongColumnTest.col";
+};
+}  // namespace
+
+TEST_F(StrongColumnFile, write_and_map) {
+  std::vector<StoredId> ids;
+  for (std::int64_t i = 0; i < 10000; ++i) {
+    ids.emplace_back(i * i - 5000);
+  }
+  strong::write_column(path, std::span<const StoredId>{ids});
+  ASSERT_EQ(std::filesystem::file_size(path),
+            sizeof(strong::ColumnHeader) + ids.size() * sizeof(StoredId));
+
+  MappedStrongColumn<StoredId> column{path};
+  ASSERT_EQ(column.size(), ids.size());
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(column.data()) %
+                alignof(StoredId),
+            0);
+  ASSERT_TRUE(std::equal(column.begin(), column.end(), ids.begin()));
+  ASSERT_EQ(column[9999], ids[9999]);
+
+  auto moved = std::move(column);
+  ASSERT_TRUE(column.empty());
+  ASSERT_EQ(moved.span().back(), ids.back());
+}
+
+TEST_F(StrongColumnFile, compressed_and_empty) {
+  const std::vector<SmallLevel> levels{SmallLevel{0}, SmallLevel{200},
+                                       SmallLevel{7}};
+  strong::write_column<SmallLevel>(path, levels);
+  ASSERT_EQ(std::filesystem::file_size(path),
+            sizeof(strong::ColumnHeader) + 3);
+  const MappedStrongColumn<SmallLevel> column{path};
+  ASSERT_TRUE(std::equal(column.begin(), column.end(), levels.begin(),
+                         levels.end()));
+
+  strong::write_column<StoredId>(path, {});
+  ASSERT_TRUE(MappedStrongColumn<StoredId>{path}.empty());
+}
+
+TEST_F(StrongColumnFile, rejects_foreign_files) {
+  const std::vector<StoredId> ids{StoredId{1}, StoredId{2}};
+  strong::write_column<StoredId>(path, ids);
+  ASSERT_THROW(MappedStrongColumn<OtherId>{path}, std::runtime_error);
+  ASSERT_THROW(MappedStrongColumn<PinnedId>{path}, std::runtime_error);
+
+  strong::write_column<PinnedId>(path, {});
+  ASSERT_NO_THROW(MappedStrongColumn<PinnedId>{path});
+
+  // a truncated payload
+  strong::write_column<StoredId>(path, ids);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  ASSERT_THROW(MappedStrongColumn<StoredId>{path}, std::runtime_error);
+
+  std::ofstream{path} << "no column";
+  ASSERT_THROW(MappedStrongColumn<StoredId>{path}, std::runtime_error);
+  std::filesystem::remove(path);
+  ASSERT_THROW(MappedStrongColumn<StoredId>{path}, std::system_error);
+}
+
+namespace {
+// overwrites the value at index of a column file with raw bytes
+template <typename T, typename U>
+void corrupt(const std::filesystem::path& path, std::size_t index, U value) {
+  std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+  file.seekp(static_cast<std::streamoff>(sizeof(strong::ColumnHeader) +
+                                         index * sizeof(T)));
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+}  // namespace
+
+TEST_F(StrongColumnFile, validates_on_open) {
+  std::vector<BoundedId> ids;
+  for (std::int64_t i = 0; i < 1000; ++i) {
+    ids.emplace_back(i * 1000);
+  }
+  strong::write_column<BoundedId>(path, ids);
+  ASSERT_EQ(MappedStrongColumn<BoundedId>{path}[999], BoundedId{999'000});
+  corrupt<BoundedId>(path, 777, std::int64_t{-1});
+  try {
+    const MappedStrongColumn<BoundedId> column{path};
+    FAIL() << "expected std::runtime_error";
+  } catch (const std::runtime_error& error) {
+    ASSERT_NE(std::string{error.what()}.find("offset 777"), std::string::npos);
+  }
+
+  // compressed values are checked after decompression
+  const std::vector<SmallLevel> levels{SmallLevel{0}, SmallLevel{200}};
+  strong::write_column<SmallLevel>(path, levels);
+  corrupt<SmallLevel>(path, 1, std::uint8_t{201});
+  ASSERT_THROW(MappedStrongColumn<SmallLevel>{path}, std::runtime_error);
+}
+
+TEST_F(StrongColumnFile, write_errors) {
+  const std::vector<StoredId> ids{StoredId{1}};
+  const auto missing = path.parent_path() / "missing_dir" / "column.col";
+  try {
+    strong::write_column<StoredId>(missing, ids);
+    FAIL() << "expected std::system_error";
+  } catch (const std::system_error& error) {
+    ASSERT_EQ(error.code(), std::errc::no_such_file_or_directory);
+  }
+  // opens, but every write fails
+  if (std::filesystem::exists("/dev/full")) {
+    try {
+      strong::write_column<StoredId>("/dev/full", ids);
+      FAIL() << "expected std::system_error";
+    } catch (const std::system_error& error) {
+      ASSERT_EQ(error.code(), std::errc::io_error);
+    }
+  }
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongConcurrentSet.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct RecordIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using RecordId = StrongType<RecordIdConfig>;
+
+struct ShortIdConfig : RecordIdConfig {
+  using underlyingType = std::uint16_t;
+};
+using ShortId = StrongType<ShortIdConfig>;
+
+struct UnequalIdConfig : RecordIdConfig {
+  static constexpr bool equal = false;
+};
+struct NameConfig : RecordIdConfig {
+  using underlyingType = std::string;
+};
+
+static_assert(isConcurrentSetKey<RecordId>);
+static_assert(isConcurrentSetKey<ShortId>);
+static_assert(!isConcurrentSetKey<StrongType<UnequalIdConfig>>);
+static_assert(!isConcurrentSetKey<StrongType<NameConfig>>);
+static_assert(sizeof(std::atomic<std::uint16_t>) == sizeof(ShortId));
+
+TEST(StrongConcurrentSet, insert_contains) {
+  StrongConcurrentSet<RecordId> set{16};
+  ASSERT_TRUE(set.empty());
+  ASSERT_TRUE(set.insert(RecordId{42}));
+  ASSERT_FALSE(set.insert(RecordId{42}));
+  ASSERT_TRUE(set.contains(RecordId{42}));
+  ASSERT_FALSE(set.contains(RecordId{43}));
+  ASSERT_EQ(set.size(), 1);
+}
+
+TEST(StrongConcurrentSet, reserved_values) {
+  // the values marking empty and sealed slots are keys as well
+  StrongConcurrentSet<RecordId> set;
+  ASSERT_FALSE(set.contains(RecordId{0}));
+  ASSERT_FALSE(set.contains(RecordId{-1}));
+  ASSERT_TRUE(set.insert(RecordId{0}));
+  ASSERT_TRUE(set.insert(RecordId{-1}));
+  ASSERT_FALSE(set.insert(RecordId{0}));
+  ASSERT_FALSE(set.insert(RecordId{-1}));
+  ASSERT_TRUE(set.contains(RecordId{0}));
+  ASSERT_TRUE(set.contains(RecordId{-1}));
+  ASSERT_EQ(set.size(), 2);
+}
+
+TEST(StrongConcurrentSet, grows) {
+  StrongConcurrentSet<ShortId> set{16};
+  ASSERT_EQ(set.capacity(), 32);
+  for (std::uint16_t i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(set.insert(ShortId{i}));
+  }
+  // the keys of the full tables have been moved along
+  ASSERT_GE(set.capacity(), 8192);
+  ASSERT_LE(set.tableCount(), 2);
+  for (std::uint16_t i = 0; i < 5000; ++i) {
+    ASSERT_FALSE(set.insert(ShortId{i}));
+    ASSERT_TRUE(set.contains(ShortId{i}));
+  }
+  ASSERT_FALSE(set.contains(ShortId{5000}));
+  ASSERT_EQ(set.size(), 5000);
+}
+
+TEST(StrongConcurrentSet, threads_insert_once) {
+  // every thread inserts the same keys, while the set grows
+  constexpr int threadCount = 4;
+  constexpr std::int64_t keys = 20000;
+  StrongConcurrentSet<RecordId> set{64};
+  std::atomic<std::int64_t> inserted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t] {
+      std::int64_t own = 0;
+      for (std::int64_t i = 0; i < keys; ++i) {
+        const auto key = (i * 7 + t * 13) % keys;
+        own += set.insert(RecordId{key}) ? 1 : 0;
+        EXPECT_TRUE(set.contains(RecordId{key}));
+      }
+      inserted += own;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(inserted.load(), keys);
+  ASSERT_EQ(set.size(), static_cast<std::size_t>(keys));
+  for (std::int64_t i = 0; i < keys; ++i) {
+    ASSERT_TRUE(set.contains(RecordId{i}));
+  }
+}
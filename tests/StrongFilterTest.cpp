@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongFilter.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct FilterIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using FilterId = StrongType<FilterIdConfig>;
+
+struct FilterNameConfig : FilterIdConfig {
+  using underlyingType = std::string;
+};
+using FilterName = StrongType<FilterNameConfig>;
+
+struct UnhashedIdConfig : FilterIdConfig {
+  static constexpr bool hash = false;
+};
+
+static_assert(isStrongFilterKey<FilterId>);
+static_assert(isStrongFilterKey<FilterName>);
+static_assert(!isStrongFilterKey<StrongType<UnhashedIdConfig>>);
+static_assert(StrongCuckooFilter<FilterId>::false_positive_rate < 0.0002);
+static_assert(StrongCuckooFilter<FilterId, 8>::false_positive_rate < 0.07);
+
+namespace {
+constexpr std::int64_t filterKeys = 100000;
+
+auto makeIds(std::int64_t first, std::int64_t count) -> std::vector<FilterId> {
+  std::vector<FilterId> ids;
+  for (std::int64_t i = first; i < first + count; ++i) {
+    ids.emplace_back(i * 7919);
+  }
+  return ids;
+}
+
+// share of keys the filter contains, from the batch lookup
+template <typename Filter>
+auto containedShare(const Filter& filter, const std::vector<FilterId>& ids)
+    -> double {
+  std::size_t contained = 0;
+  for (const auto word : filter.contains(std::span<const FilterId>{ids})) {
+    contained += static_cast<std::size_t>(std::popcount(word));
+  }
+  return static_cast<double>(contained) / static_cast<double>(ids.size());
+}
+}  // namespace
+
+TEST(StrongBloomFilter, no_false_negatives) {
+  StrongBloomFilter<FilterId> filter{filterKeys};
+  const auto ids = makeIds(0, filterKeys);
+  for (const auto& id : ids) {
+    filter.insert(id);
+  }
+  for (const auto& id : ids) {
+    ASSERT_TRUE(filter.contains(id));
+  }
+  ASSERT_EQ(containedShare(filter, ids), 1.0);
+  ASSERT_EQ(filter.size(), static_cast<std::size_t>(filterKeys));
+}
+
+TEST(StrongBloomFilter, false_positive_rate) {
+  for (const double target : {0.01, 0.001}) {
+    StrongBloomFilter<FilterId> filter{filterKeys, target};
+    for (const auto& id : makeIds(0, filterKeys)) {
+      filter.insert(id);
+    }
+    const auto share = containedShare(filter, makeIds(filterKeys, filterKeys));
+    ASSERT_LT(share, target * 1.5);
+    ASSERT_LE(filter.falsePositiveRate(), target);
+  }
+  // a lower rate costs more bits
+  ASSERT_LT(StrongBloomFilter<FilterId>(1000, 0.01).bitCount(),
+            StrongBloomFilter<FilterId>(1000, 0.001).bitCount());
+  ASSERT_THROW(StrongBloomFilter<FilterId>(1000, 0.0), std::invalid_argument);
+  ASSERT_THROW(StrongBloomFilter<FilterId>(1000, 1.0), std::invalid_argument);
+}
+
+TEST(StrongBloomFilter, batch_mask) {
+  StrongBloomFilter<FilterName> filter{100};
+  filter.insert(FilterName{"alpha"});
+  filter.insert(FilterName{"gamma"});
+  const std::vector<FilterName> names{FilterName{"alpha"}, FilterName{"beta"},
+                                      FilterName{"gamma"}};
+  const auto mask = filter.contains(std::span<const FilterName>{names});
+  ASSERT_EQ(mask.size(), 1);
+  ASSERT_EQ(mask[0] & 0b101, 0b101);
+  ASSERT_EQ((mask[0] >> 1) & 1, filter.contains(FilterName{"beta"}) ? 1 : 0);
+}
+
+TEST(StrongBloomFilter, serialize) {
+  StrongBloomFilter<FilterId> filter{1000, 0.001};
+  for (const auto& id : makeIds(0, 1000)) {
+    filter.insert(id);
+  }
+  const auto bytes = filter.serialize();
+  const auto copy = StrongBloomFilter<FilterId>::deserialize(bytes);
+  ASSERT_EQ(copy.size(), filter.size());
+  ASSERT_EQ(copy.bitCount(), filter.bitCount());
+  const auto probes = makeIds(0, 3000);
+  ASSERT_EQ(copy.contains(std::span<const FilterId>{probes}),
+            filter.contains(std::span<const FilterId>{probes}));
+
+  ASSERT_THROW(static_cast<void>(StrongBloomFilter<FilterName>::deserialize(
+                   bytes)),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(StrongCuckooFilter<FilterId>::deserialize(
+                   bytes)),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(StrongBloomFilter<FilterId>::deserialize(
+                   std::span{bytes}.first(bytes.size() - 1))),
+               std::invalid_argument);
+}
+
+TEST(StrongCuckooFilter, insert_contains_erase) {
+  StrongCuckooFilter<FilterId> filter{filterKeys};
+  const auto ids = makeIds(0, filterKeys);
+  for (const auto& id : ids) {
+    ASSERT_TRUE(filter.insert(id));
+  }
+  ASSERT_EQ(containedShare(filter, ids), 1.0);
+  ASSERT_LT(containedShare(filter, makeIds(filterKeys, filterKeys)),
+            StrongCuckooFilter<FilterId>::false_positive_rate);
+
+  // erase every other key, the others stay
+  for (std::size_t i = 0; i < ids.size(); i += 2) {
+    ASSERT_TRUE(filter.erase(ids[i]));
+  }
+  for (std::size_t i = 1; i < ids.size(); i += 2) {
+    ASSERT_TRUE(filter.contains(ids[i]));
+  }
+  ASSERT_EQ(filter.size(), ids.size() / 2);
+}
+
+TEST(StrongCuckooFilter, full) {
+  StrongCuckooFilter<FilterId, 8> filter{1000};
+  const auto capacity = filter.bitCount() / 8;
+  std::size_t inserted = 0;
+  for (const auto& id : makeIds(0, static_cast<std::int64_t>(capacity))) {
+    if (!filter.insert(id)) {
+      break;
+    }
+    ++inserted;
+  }
+  // fills most of the slots before the first insert fails
+  ASSERT_GT(inserted, capacity * 9 / 10);
+  ASSERT_LT(inserted, capacity);
+  for (const auto& id : makeIds(0, static_cast<std::int64_t>(inserted))) {
+    ASSERT_TRUE(filter.contains(id));
+  }
+  // erasing makes room again, the stashed victim goes back to its bucket
+  for (const auto& id : makeIds(0, static_cast<std::int64_t>(inserted / 2))) {
+    ASSERT_TRUE(filter.erase(id));
+  }
+  ASSERT_TRUE(filter.insert(FilterId{-1}));
+  ASSERT_TRUE(filter.contains(FilterId{-1}));
+}
+
+TEST(StrongCuckooFilter, serialize) {
+  StrongCuckooFilter<FilterId, 32> filter{1000};
+  for (const auto& id : makeIds(0, 1000)) {
+    ASSERT_TRUE(filter.insert(id));
+  }
+  const auto bytes = filter.serialize();
+  auto copy = StrongCuckooFilter<FilterId, 32>::deserialize(bytes);
+  ASSERT_EQ(copy.size(), 1000);
+  const auto probes = makeIds(0, 3000);
+  ASSERT_EQ(copy.contains(std::span<const FilterId>{probes}),
+            filter.contains(std::span<const FilterId>{probes}));
+  ASSERT_TRUE(copy.erase(FilterId{0}));
+  ASSERT_THROW(static_cast<void>(
+                   StrongCuckooFilter<FilterId, 16>::deserialize(bytes)),
+               std::invalid_argument);
+}
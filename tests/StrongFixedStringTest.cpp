@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongFixedString.h>
+#include <StrongTypes/StrongHashMap.h>
+#include <StrongTypes/StrongSort.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct TickerConfig {
+  using underlyingType = strong::FixedString<12>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using Ticker = StrongType<TickerConfig>;
+using IsoCode = StrongFixedString<3>;
+
+static_assert(sizeof(Ticker) == 13);
+static_assert(sizeof(IsoCode) == 4);
+static_assert(std::is_trivially_copyable_v<Ticker>);
+static_assert(std::is_trivially_copyable_v<StrongFixedString<36>>);
+static_assert(std::is_convertible_v<decltype(std::declval<Ticker>().get()),
+                                    std::string_view>);
+// a literal longer than the capacity doesn't compile
+static_assert(strong::FixedString<3>{"EUR"}.size() == 3);
+static_assert(std::is_convertible_v<const char(&)[4], strong::FixedString<3>>);
+static_assert(
+    !std::is_convertible_v<const char(&)[5], strong::FixedString<3>>);
+static_assert(IsoCode{"EUR"} < IsoCode{"USD"});
+static_assert(IsoCode{"EU"}.get().size() == 2);
+
+TEST(StrongFixedString, construct_and_view) {
+  const Ticker ticker{"AAPL"};
+  const std::string_view view = ticker.get();
+  ASSERT_EQ(view, "AAPL");
+  ASSERT_EQ(ticker.get().size(), 4);
+  ASSERT_TRUE(Ticker{}.get().empty());
+
+  const std::string parsed = "MSFT.O";
+  const Ticker runtime{strong::FixedString<12>{parsed}};
+  ASSERT_EQ(std::string_view{runtime.get()}, parsed);
+  ASSERT_THROW(strong::FixedString<12>{std::string(13, 'x')},
+               std::length_error);
+  const strong::FixedString<12> full{std::string(12, 'x')};
+  ASSERT_EQ(full.size(), 12);
+}
+
+TEST(StrongFixedString, comparison_like_std_string) {
+  const std::vector<std::string> texts{"",   "A",   "AB", "AAPL", "AAP",
+                                       "B",  "a",   "Z",  "ZZZZ", "\xff",
+                                       "AA", "A\0"};
+  for (const auto& lhs : texts) {
+    for (const auto& rhs : texts) {
+      const strong::FixedString<12> left{lhs};
+      const strong::FixedString<12> right{rhs};
+      ASSERT_EQ(left == right, lhs == rhs) << lhs << " " << rhs;
+      ASSERT_EQ(left < right, lhs < rhs) << lhs << " " << rhs;
+      ASSERT_EQ(left <=> right, lhs <=> rhs) << lhs << " " << rhs;
+    }
+  }
+  const strong::FixedString<12> embedded{std::string_view{"A\0", 2}};
+  ASSERT_NE(embedded, (strong::FixedString<12>{"A"}));
+  ASSERT_GT(embedded, (strong::FixedString<12>{"A"}));
+}
+
+TEST(StrongFixedString, hash_and_sort) {
+  StrongHashMap<Ticker, int> prices;
+  prices[Ticker{"AAPL"}] = 1;
+  prices[Ticker{"MSFT"}] = 2;
+  ASSERT_EQ(prices.at(Ticker{"AAPL"}), 1);
+  ASSERT_FALSE(prices.contains(Ticker{"GOOG"}));
+  ASSERT_EQ(std::hash<strong::FixedString<12>>{}(Ticker{"AAPL"}.get()),
+            std::hash<std::string_view>{}("AAPL"));
+
+  std::vector<Ticker> tickers{Ticker{"MSFT"}, Ticker{"AAPL"}, Ticker{"AAP"}};
+  strong::sort(tickers);
+  ASSERT_EQ(tickers[0], Ticker{"AAP"});
+  ASSERT_EQ(tickers[2], Ticker{"MSFT"});
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongFormat.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+struct DbIdConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool format = true;
+  static constexpr std::string_view formatPrefix = "db#";
+};
+using DbId = StrongType<DbIdConfig>;
+
+struct RowCountConfig : DbIdConfig {
+  using underlyingType = std::uint32_t;
+  static constexpr std::string_view formatPrefix = "";
+};
+using RowCount = StrongType<RowCountConfig>;
+
+struct PercentageConfig : DbIdConfig {
+  using underlyingType = int;
+  using validator = strong::InRange<0, 100>;
+  static constexpr bool compact = true;
+};
+using Percentage = StrongType<PercentageConfig>;
+
+struct RatioConfig : DbIdConfig {
+  using underlyingType = double;
+};
+using Ratio = StrongType<RatioConfig>;
+
+TEST(StrongFormat, to_chars_and_from_chars) {
+  char text[32];
+  const auto written = strong::to_chars(text, text + sizeof(text), DbId{-42});
+  ASSERT_EQ(written.ec, std::errc{});
+  ASSERT_EQ(std::string_view(text, written.ptr), "-42");
+  const auto hex = strong::to_chars(text, text + sizeof(text), DbId{255}, 16);
+  ASSERT_EQ(std::string_view(text, hex.ptr), "ff");
+  ASSERT_EQ(strong::to_chars(text, text + 1, DbId{255}).ec,
+            std::errc::value_too_large);
+
+  DbId id{1};
+  const std::string_view number = "123456789012,";
+  const auto parsed =
+      strong::from_chars(number.data(), number.data() + number.size(), id);
+  ASSERT_EQ(parsed.ec, std::errc{});
+  ASSERT_EQ(*parsed.ptr, ',');
+  ASSERT_EQ(id, DbId{123456789012});
+
+  Percentage percent{5};
+  const std::string_view tooLarge = "101";
+  ASSERT_EQ(strong::from_chars(tooLarge.data(),
+                               tooLarge.data() + tooLarge.size(), percent)
+                .ec,
+            std::errc::result_out_of_range);
+  ASSERT_EQ(percent, Percentage{5});
+  const std::string_view none = "x";
+  ASSERT_EQ(strong::from_chars(none.data(), none.data() + 1, id).ec,
+            std::errc::invalid_argument);
+}
+
+TEST(StrongFormat, parse_column) {
+  const auto ids = strong::parse_column<DbId>(
+      "1\n-22\n333333333\n9223372036854775807\n-9223372036854775808\n0\n",
+      '\n');
+  const std::vector<DbId> expected{DbId{1},
+                                   DbId{-22},
+                                   DbId{333333333},
+                                   DbId{std::numeric_limits<int64_t>::max()},
+                                   DbId{std::numeric_limits<int64_t>::min()},
+                                   DbId{0}};
+  ASSERT_EQ(ids, expected);
+  ASSERT_TRUE(strong::parse_column<DbId>("", ',').empty());
+  ASSERT_EQ(strong::parse_column<Ratio>("0.5;1e3", ';'),
+            (std::vector<Ratio>{Ratio{0.5}, Ratio{1000.0}}));
+
+  ASSERT_THROW(static_cast<void>(strong::parse_column<DbId>("1,x2,3", ',')),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(strong::parse_column<DbId>("1,,3", ',')),
+               std::invalid_argument);
+  ASSERT_THROW(
+      static_cast<void>(strong::parse_column<DbId>("12345678a,1", ',')),
+      std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(strong::parse_column<RowCount>("-1", ',')),
+               std::invalid_argument);
+  ASSERT_THROW(
+      static_cast<void>(strong::parse_column<RowCount>("4294967296", ',')),
+      std::invalid_argument);
+  ASSERT_THROW(
+      static_cast<void>(strong::parse_column<Percentage>("50,101", ',')),
+      std::invalid_argument);
+  try {
+    static_cast<void>(strong::parse_column<DbId>("10,20,3-0", ','));
+    FAIL();
+  } catch (const std::invalid_argument& error) {
+    ASSERT_NE(std::string{error.what()}.find("offset 6"), std::string::npos);
+  }
+}
+
+TEST(StrongFormat, parse_column_like_from_chars) {
+  std::mt19937_64 gen{42};
+  std::string text;
+  std::vector<DbId> expected;
+  for (int i = 0; i < 10000; ++i) {
+    const auto digits = static_cast<int>(gen() % 20);
+    const auto value = static_cast<std::int64_t>(gen()) >> (3 * digits);
+    expected.emplace_back(value);
+    text += std::to_string(value);
+    text += ',';
+  }
+  ASSERT_EQ(strong::parse_column<DbId>(text, ','), expected);
+  // the fast path must not read beyond the buffer
+  for (std::size_t length = 1; length < 20; ++length) {
+    const std::string digits(length, '7');
+    ASSERT_EQ(strong::parse_column<DbId>(digits, ',').front(),
+              DbId{std::stoll(digits)});
+  }
+}
+
+#if defined(__cpp_lib_format)
+TEST(StrongFormat, formatter) {
+  ASSERT_EQ(std::format("{}", DbId{42}), "db#42");
+  ASSERT_EQ(std::format("{:>5}", RowCount{7}), "    7");
+  ASSERT_EQ(std::format("{:x}", DbId{255}), "db#ff");
+}
+#endif
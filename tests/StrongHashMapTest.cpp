@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongHashMap.h>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+struct HashedIdConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using HashedId = StrongType<HashedIdConfig>;
+
+struct HashedNameConfig {
+  using underlyingType = std::string;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = true;
+  static constexpr bool hash = true;
+};
+using HashedName = StrongType<HashedNameConfig>;
+
+struct UnhashedConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+
+static_assert(isHashEnabled<HashedIdConfig>);
+static_assert(!isHashEnabled<UnhashedConfig>);
+static_assert(std::is_default_constructible_v<std::hash<HashedId>>);
+static_assert(
+    !std::is_default_constructible_v<std::hash<StrongType<UnhashedConfig>>>);
+static_assert(isStrongHashKey<HashedId>);
+static_assert(!isStrongHashKey<StrongType<UnhashedConfig>>);
+static_assert(noexcept(std::hash<HashedId>{}(HashedId{1})));
+static_assert(std::hash<HashedId>{}(HashedId{1}) == strong::hashValue(1L));
+
+template <typename Map, typename Key>
+concept findableBy = requires(const Map& map, const Key& key) {
+  map.find(key);
+};
+static_assert(!findableBy<StrongHashMap<HashedId, int>, long>);
+static_assert(findableBy<StrongHashMap<HashedName, int>, std::string>);
+
+TEST(Hash, std_containers) {
+  std::unordered_set<HashedId> ids{HashedId{1}, HashedId{2}, HashedId{1}};
+  ASSERT_EQ(ids.size(), 2);
+  ASSERT_EQ(std::hash<HashedName>{}(HashedName{"a"}),
+            std::hash<std::string>{}("a"));
+}
+
+TEST(StrongHashMap, insert_find_erase) {
+  StrongHashMap<HashedId, int> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.find(HashedId{1}), map.end());
+
+  ASSERT_TRUE(map.try_emplace(HashedId{1}, 10).second);
+  ASSERT_FALSE(map.try_emplace(HashedId{1}, 20).second);
+  ASSERT_EQ(map.at(HashedId{1}), 10);
+  map[HashedId{2}] = 20;
+  ASSERT_EQ(map.size(), 2);
+  ASSERT_FALSE(map.insert_or_assign(HashedId{2}, 30).second);
+  ASSERT_EQ(map.find(HashedId{2})->second, 30);
+  ASSERT_THROW((void)map.at(HashedId{3}), std::out_of_range);
+
+  ASSERT_EQ(map.erase(HashedId{1}), 1);
+  ASSERT_EQ(map.erase(HashedId{1}), 0);
+  ASSERT_FALSE(map.contains(HashedId{1}));
+  ASSERT_TRUE(map.contains(HashedId{2}));
+  ASSERT_EQ(map.size(), 1);
+}
+
+TEST(StrongHashMap, matches_unordered_map) {
+  StrongHashMap<HashedId, long> map;
+  std::unordered_map<long, long> reference;
+  std::uint64_t state = 42;
+  for (int i = 0; i < 100000; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const auto key = static_cast<long>(state >> 50);
+    if ((state >> 20) % 3 == 0) {
+      ASSERT_EQ(map.erase(HashedId{key}), reference.erase(key));
+    } else {
+      map[HashedId{key}] += i;
+      reference[key] += i;
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  std::size_t visited = 0;
+  for (auto [key, value] : map) {
+    ASSERT_EQ(reference.at(key.get()), value);
+    ++visited;
+  }
+  ASSERT_EQ(visited, reference.size());
+}
+
+TEST(StrongHashMap, copy_and_move) {
+  StrongHashMap<HashedName, std::string> map;
+  for (int i = 0; i < 100; ++i) {
+    map.try_emplace(HashedName{std::to_string(i)}, std::string(i, 'x'));
+  }
+  auto copy = map;
+  ASSERT_EQ(copy.size(), 100);
+  ASSERT_EQ(copy.at(HashedName{"42"}), std::string(42, 'x'));
+  ASSERT_NE(copy.find(std::string{"42"}), copy.end());
+
+  auto moved = std::move(copy);
+  ASSERT_EQ(moved.size(), 100);
+  ASSERT_TRUE(moved.contains(std::string{"99"}));
+
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  ASSERT_EQ(moved.begin(), moved.end());
+  ASSERT_EQ(map.size(), 100);
+}
+
+TEST(StrongHashSet, insert_contains) {
+  StrongHashSet<HashedId> set;
+  set.reserve(1000);
+  const auto capacity = set.capacity();
+  for (long i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(set.insert(HashedId{i}).second);
+  }
+  ASSERT_EQ(set.capacity(), capacity);
+  ASSERT_FALSE(set.insert(HashedId{5}).second);
+  ASSERT_EQ(set.size(), 1000);
+  for (long i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(set.contains(HashedId{i}));
+  }
+  ASSERT_FALSE(set.contains(HashedId{1000}));
+  long sum = 0;
+  for (const auto& id : set) {
+    sum += id.get();
+  }
+  ASSERT_EQ(sum, 999 * 1000 / 2);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongIdGenerator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+struct EntityIdConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using EntityId = StrongType<EntityIdConfig>;
+
+struct TinyIdConfig {
+  using underlyingType = std::int8_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using TinyId = StrongType<TinyIdConfig>;
+
+static_assert(isStrongIdType<EntityId>);
+static_assert(!isStrongIdType<long>);
+
+TEST(StrongIdGenerator, start_value) {
+  StrongIdGenerator<EntityId> generator{100, 4};
+  ASSERT_EQ(generator.next(), EntityId{100});
+  ASSERT_EQ(generator.next(), EntityId{101});
+  // the whole block is reserved
+  ASSERT_EQ(generator.highWaterMark(), 104);
+  ASSERT_THROW((StrongIdGenerator<EntityId>{1, 0}), std::invalid_argument);
+}
+
+TEST(StrongIdGenerator, unique_across_threads) {
+  StrongIdGenerator<EntityId> generator{1, 16};
+  constexpr std::size_t threads = 8;
+  constexpr std::size_t perThread = 10'000;
+  std::vector<std::vector<EntityId>> ids(threads);
+  {
+    std::vector<std::jthread> workers;
+    for (std::size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&, thread] {
+        for (std::size_t i = 0; i < perThread; ++i) {
+          ids[thread].push_back(generator.next());
+        }
+      });
+    }
+  }
+  std::vector<EntityId> all;
+  for (const auto& own : ids) {
+    ASSERT_TRUE(std::is_sorted(own.begin(), own.end()));
+    ASSERT_EQ(std::adjacent_find(own.begin(), own.end()), own.end());
+    all.insert(all.end(), own.begin(), own.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+  ASSERT_GT(generator.highWaterMark(), all.back().get());
+}
+
+TEST(StrongIdGenerator, restore_high_water_mark) {
+  long mark = 0;
+  {
+    StrongIdGenerator<EntityId> generator;
+    ASSERT_EQ(generator.next(), EntityId{1});
+    mark = generator.highWaterMark();
+  }
+  StrongIdGenerator<EntityId> restarted{mark};
+  ASSERT_EQ(restarted.next(), EntityId{mark});
+
+  // the reserved block of this thread is discarded
+  restarted.restore(5000);
+  ASSERT_EQ(restarted.next(), EntityId{5000});
+  // restoring an older mark does not hand out ids twice
+  restarted.restore(10);
+  ASSERT_GT(restarted.next(), EntityId{5000});
+}
+
+TEST(StrongIdGenerator, separate_generators) {
+  StrongIdGenerator<EntityId> first{1, 8};
+  StrongIdGenerator<EntityId> second{1000, 8};
+  ASSERT_EQ(first.next(), EntityId{1});
+  ASSERT_EQ(second.next(), EntityId{1000});
+  ASSERT_EQ(first.next(), EntityId{9});
+  ASSERT_EQ(&StrongIdGenerator<EntityId>::global(),
+            &StrongIdGenerator<EntityId>::global());
+}
+
+TEST(StrongIdGenerator, exhaustion) {
+  StrongIdGenerator<TinyId> generator{120, 4};
+  std::vector<TinyId> ids;
+  ASSERT_THROW(
+      {
+        while (true) {
+          ids.push_back(generator.next());
+        }
+      },
+      std::overflow_error);
+  ASSERT_EQ(ids.size(), 7);
+  ASSERT_EQ(ids.back(), TinyId{126});
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongHashMap.h>
+#include <StrongTypes/StrongInternedString.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+struct SymbolConfig {
+  using underlyingType = strong::InternedString;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using Symbol = StrongType<SymbolConfig>;
+
+static_assert(sizeof(Symbol) == sizeof(void*));
+static_assert(std::is_trivially_copyable_v<Symbol>);
+static_assert(std::is_convertible_v<decltype(std::declval<Symbol>().get()),
+                                    std::string_view>);
+
+TEST(StrongInternedString, equality_and_hash) {
+  const Symbol first{std::in_place, "AAPL"};
+  const Symbol second{strong::InternedString{std::string{"AAP"} + "L"}};
+  const Symbol other{std::in_place, "MSFT"};
+  ASSERT_EQ(first, second);
+  ASSERT_NE(first, other);
+  ASSERT_LT(first, other);
+  ASSERT_EQ(std::hash<Symbol>{}(first), std::hash<Symbol>{}(second));
+
+  std::string_view text = first.get();
+  ASSERT_EQ(text, "AAPL");
+  // both handles point to the same characters
+  ASSERT_EQ(text.data(), std::string_view{second.get()}.data());
+}
+
+TEST(StrongInternedString, empty) {
+  const Symbol empty{};
+  ASSERT_TRUE(empty.get().empty());
+  ASSERT_EQ(empty, (Symbol{std::in_place, ""}));
+  ASSERT_LT(empty, (Symbol{std::in_place, "A"}));
+}
+
+TEST(StrongInternedString, scoped_table) {
+  strong::InternTable table;
+  const Symbol first{strong::InternedString{table, "tenant-1"}};
+  const Symbol second{strong::InternedString{table, "tenant-1"}};
+  const Symbol third{strong::InternedString{table, "tenant-2"}};
+  ASSERT_EQ(first, second);
+  ASSERT_NE(first, third);
+  ASSERT_EQ(table.size(), 2);
+  ASSERT_GT(table.arenaBytes(), 0);
+
+  // a long text does not fit into a regular arena block
+  const std::string large(200'000, 'x');
+  ASSERT_EQ(std::string_view{table.intern(large)}, large);
+}
+
+TEST(StrongInternedString, concurrent_interning) {
+  strong::InternTable table;
+  constexpr std::size_t threads = 8;
+  constexpr int values = 2000;
+  std::vector<std::vector<strong::InternedString>> handles(threads);
+  {
+    std::vector<std::jthread> workers;
+    for (std::size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&, thread] {
+        for (int i = 0; i < values; ++i) {
+          handles[thread].push_back(
+              table.intern("value-" + std::to_string(i)));
+        }
+      });
+    }
+  }
+  ASSERT_EQ(table.size(), values);
+  for (const auto& own : handles) {
+    ASSERT_EQ(own, handles.front());
+  }
+}
+
+TEST(StrongInternedString, hash_map_key) {
+  StrongHashMap<Symbol, int> prices;
+  prices[Symbol{std::in_place, "AAPL"}] = 1;
+  prices[Symbol{std::in_place, "MSFT"}] = 2;
+  ASSERT_EQ(prices.at(Symbol{std::in_place, "AAPL"}), 1);
+  ASSERT_FALSE(prices.contains(Symbol{std::in_place, "GOOG"}));
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongPack.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+template <typename T>
+struct RoutingConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+struct ShardIdConfig : RoutingConfig<int> {};
+struct PartitionConfig : RoutingConfig<std::uint16_t> {};
+struct FlagsConfig : RoutingConfig<std::uint8_t> {};
+struct VersionConfig : RoutingConfig<int> {};
+using ShardId = StrongType<ShardIdConfig>;
+using Partition = StrongType<PartitionConfig>;
+using Flags = StrongType<FlagsConfig>;
+using Version = StrongType<VersionConfig>;
+
+using Route =
+    StrongPack<strong::Field<ShardId, 10>, strong::Field<Partition, 8>,
+               strong::Field<Flags, 4>, strong::Field<Version, 10>>;
+
+struct Unpacked {
+  ShardId shard;
+  Partition partition;
+  Flags flags;
+  Version version;
+};
+
+static_assert(sizeof(Route) == 4);
+static_assert(sizeof(Unpacked) == 12);
+static_assert(std::is_same_v<Route::word_type, std::uint32_t>);
+static_assert(std::is_trivially_copyable_v<Route>);
+static_assert(
+    sizeof(StrongPack<strong::Field<ShardId, 33>, strong::Field<Flags, 1>>) ==
+    8);
+static_assert(Route{ShardId{3}, Partition{4}, Flags{5}, Version{-6}}
+                  .get<Version>() == Version{-6});
+static_assert(Route{}.get<ShardId>() == ShardId{0});
+
+struct CheckedVersionConfig : VersionConfig {
+  using validator = strong::InRange<0, 100>;
+};
+template <typename T, std::size_t bits = 8>
+concept isPackable = requires() { typename strong::Field<T, bits>; };
+static_assert(isPackable<Version>);
+// a word isn't validated, so neither are the fields
+static_assert(!isPackable<StrongType<CheckedVersionConfig>>);
+// the bits of a field must fit the storage type of a compressed StrongType
+struct SmallShardConfig : ShardIdConfig {
+  using storageType = std::int8_t;
+};
+using SmallShard = StrongType<SmallShardConfig>;
+static_assert(isPackable<SmallShard>);
+static_assert(!isPackable<SmallShard, 9>);
+
+TEST(StrongPack, get_and_set) {
+  Route route{ShardId{511}, Partition{255}, Flags{0}, Version{-512}};
+  ASSERT_EQ(route.get<ShardId>(), ShardId{511});
+  ASSERT_EQ(route.get<1>(), Partition{255});
+  ASSERT_EQ(route.get<Flags>(), Flags{0});
+  ASSERT_EQ(route.get<Version>(), Version{-512});
+
+  route.set(Flags{15});
+  route.set<3>(Version{511});
+  ASSERT_EQ(route.get<ShardId>(), ShardId{511});
+  ASSERT_EQ(route.get<Flags>(), Flags{15});
+  ASSERT_EQ(route.get<Version>(), Version{511});
+
+  ASSERT_THROW(route.set(Flags{16}), std::invalid_argument);
+  ASSERT_THROW(route.set(Version{512}), std::invalid_argument);
+  ASSERT_THROW(route.set(ShardId{-513}), std::invalid_argument);
+  ASSERT_EQ(route.get<Flags>(), Flags{15});
+
+  route.set(strong::unchecked, Flags{17});
+  ASSERT_EQ(route.get<Flags>(), Flags{1});
+  ASSERT_EQ(route.get<Partition>(), Partition{255});
+
+  ASSERT_EQ(Route::fromWord(route.toWord()), route);
+  // signed fields are 0 by default, not their minimum
+  ASSERT_EQ(Route{}.get<Version>(), Version{0});
+  ASSERT_EQ(Route{}, (Route{ShardId{0}, Partition{0}, Flags{0}, Version{0}}));
+}
+
+TEST(StrongPack, word_order_is_field_order) {
+  std::vector<Route> routes;
+  std::vector<Unpacked> expected;
+  for (int shard : {3, 1, 2}) {
+    for (int version : {5, -5, 0}) {
+      routes.emplace_back(ShardId{shard}, Partition{7}, Flags{1},
+                          Version{version});
+      expected.push_back({ShardId{shard}, Partition{7}, Flags{1},
+                          Version{version}});
+    }
+  }
+  std::sort(routes.begin(), routes.end());
+  std::sort(expected.begin(), expected.end(),
+            [](const Unpacked& lhs, const Unpacked& rhs) {
+              return std::tie(lhs.shard, lhs.version) <
+                     std::tie(rhs.shard, rhs.version);
+            });
+  for (std::size_t i = 0; i < routes.size(); ++i) {
+    ASSERT_EQ(routes[i].get<ShardId>(), expected[i].shard);
+    ASSERT_EQ(routes[i].get<Version>(), expected[i].version);
+  }
+}
+
+TEST(StrongPack, hash) {
+  std::unordered_set<Route> routes;
+  routes.insert(Route{ShardId{1}, Partition{2}, Flags{3}, Version{4}});
+  ASSERT_TRUE(
+      routes.contains(Route{ShardId{1}, Partition{2}, Flags{3}, Version{4}}));
+  ASSERT_FALSE(
+      routes.contains(Route{ShardId{1}, Partition{2}, Flags{3}, Version{5}}));
+}
+
+TEST(StrongPack, atomic_field_updates) {
+  ASSERT_EQ(StrongAtomicPack<Route>{}.load(), Route{});
+  StrongAtomicPack<Route> shared{
+      Route{ShardId{0}, Partition{0}, Flags{0}, Version{0}}};
+  constexpr int updates = 10'000;
+  {
+    // every thread owns one field, the others must never be lost
+    std::jthread shards{[&] {
+      for (int i = 0; i < updates; ++i) {
+        shared.set(ShardId{i % 512});
+      }
+    }};
+    std::jthread versions{[&] {
+      for (int i = 0; i < updates; ++i) {
+        shared.update([](Route route) {
+          const auto version = route.get<Version>().get();
+          route.set(Version{version == 511 ? -512 : version + 1});
+          return route;
+        });
+      }
+    }};
+  }
+  const auto route = shared.load();
+  ASSERT_EQ(route.get<ShardId>(), ShardId{(updates - 1) % 512});
+  ASSERT_EQ(route.get<Version>(), Version{(updates + 512) % 1024 - 512});
+  ASSERT_THROW(shared.set(Flags{16}), std::invalid_argument);
+  ASSERT_EQ(shared.get<Flags>(), Flags{0});
+
+  auto expected = route;
+  ASSERT_TRUE(shared.compare_exchange_strong(expected, Route{}));
+  ASSERT_FALSE(shared.compare_exchange_strong(expected, route));
+  ASSERT_EQ(expected, Route{});
+}
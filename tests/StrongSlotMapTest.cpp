@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongHashMap.h>
+#include <StrongTypes/StrongSlotMap.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct EntityTag {};
+using EntityHandle = StrongHandle<EntityTag>;
+struct WidgetTag {};
+using WidgetHandle = StrongHandle<WidgetTag>;
+
+static_assert(sizeof(EntityHandle) == sizeof(std::uint64_t));
+static_assert(!std::is_convertible_v<EntityHandle, WidgetHandle>);
+static_assert(isEqualComparable<EntityHandle>);
+static_assert(!isLessThenComparable<EntityHandle>);
+
+// handles with ordering, via a custom config
+struct OrderedHandleConfig : strong::HandleConfig<EntityTag> {
+  static constexpr bool spaceship = true;
+  static constexpr bool lessThen = true;
+};
+using OrderedHandle = StrongType<OrderedHandleConfig>;
+static_assert(isStrongHandle<OrderedHandle>);
+
+TEST(StrongSlotMap, insert_find_erase) {
+  StrongSlotMap<EntityHandle, std::string> names;
+  const auto alice = names.insert("alice");
+  const auto bob = names.emplace(3, 'b');
+  ASSERT_EQ(names.size(), 2);
+  ASSERT_NE(alice, bob);
+  ASSERT_EQ(names.at(alice), "alice");
+  ASSERT_EQ(*names.find(bob), "bbb");
+
+  ASSERT_TRUE(names.erase(alice));
+  ASSERT_FALSE(names.erase(alice));
+  ASSERT_FALSE(names.contains(alice));
+  ASSERT_EQ(names.find(alice), nullptr);
+  ASSERT_THROW(static_cast<void>(names.at(alice)), std::out_of_range);
+  // bob moved into the gap but its handle stays valid
+  ASSERT_EQ(names.at(bob), "bbb");
+
+  // the slot is reused with a new generation
+  const auto carol = names.insert("carol");
+  ASSERT_EQ(strong::handleIndex(carol), strong::handleIndex(alice));
+  ASSERT_NE(strong::handleGeneration(carol), strong::handleGeneration(alice));
+  ASSERT_FALSE(names.contains(alice));
+  ASSERT_EQ(names.at(carol), "carol");
+}
+
+TEST(StrongSlotMap, forged_and_default_handles) {
+  StrongSlotMap<EntityHandle, int> values;
+  ASSERT_FALSE(values.contains(EntityHandle{0}));
+  const auto handle = values.insert(1);
+  values.erase(handle);
+  // a free slot never matches, whatever generation is guessed
+  for (std::uint32_t generation = 0; generation < 8; ++generation) {
+    ASSERT_FALSE(values.contains(strong::makeHandle<EntityHandle>(
+        strong::handleIndex(handle), generation)));
+  }
+  ASSERT_FALSE(values.contains(strong::makeHandle<EntityHandle>(100, 1)));
+}
+
+TEST(StrongSlotMap, iteration_and_clear) {
+  StrongSlotMap<OrderedHandle, int> values;
+  std::vector<OrderedHandle> handles;
+  for (int i = 0; i < 10; ++i) {
+    handles.push_back(values.insert(i));
+  }
+  values.erase(handles[3]);
+  values.erase(handles[7]);
+  int sum = 0;
+  for (const auto value : values) {
+    sum += value;
+  }
+  ASSERT_EQ(sum, 45 - 3 - 7);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values.at(values.handleAt(i)), values.data()[i]);
+  }
+  std::sort(handles.begin(), handles.end());
+
+  values.clear();
+  ASSERT_TRUE(values.empty());
+  for (const auto& handle : handles) {
+    ASSERT_FALSE(values.contains(handle));
+  }
+}
+
+TEST(StrongSlotMap, matches_unordered_map_under_churn) {
+  StrongSlotMap<EntityHandle, int> slots;
+  std::unordered_map<std::uint64_t, int> reference;
+  std::vector<EntityHandle> live;
+  std::vector<EntityHandle> stale;
+  std::mt19937 random{7};
+  for (int step = 0; step < 100'000; ++step) {
+    if (live.empty() || random() % 3 != 0) {
+      const auto handle = slots.insert(step);
+      ASSERT_TRUE(reference.emplace(handle.get(), step).second);
+      live.push_back(handle);
+    } else {
+      const auto at = random() % live.size();
+      ASSERT_TRUE(slots.erase(live[at]));
+      reference.erase(live[at].get());
+      stale.push_back(live[at]);
+      live[at] = live.back();
+      live.pop_back();
+    }
+  }
+  ASSERT_EQ(slots.size(), reference.size());
+  for (const auto& handle : live) {
+    ASSERT_EQ(slots.at(handle), reference.at(handle.get()));
+  }
+  for (const auto& handle : stale) {
+    ASSERT_FALSE(slots.contains(handle));
+  }
+  // handles are hashable keys themselves
+  StrongHashMap<EntityHandle, int> index;
+  index[live.front()] = 1;
+  ASSERT_TRUE(index.contains(live.front()));
+}
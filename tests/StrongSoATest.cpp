@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongAlgorithms.h>
+#include <StrongTypes/StrongSoA.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+template <typename T>
+struct RecordFieldConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+struct RecordIdConfig : RecordFieldConfig<std::int64_t> {};
+struct RecordPriceConfig : RecordFieldConfig<double> {};
+struct RecordQtyConfig : RecordFieldConfig<std::int32_t> {};
+struct RecordNameConfig : RecordFieldConfig<std::string> {};
+using RecordId = StrongType<RecordIdConfig>;
+using RecordPrice = StrongType<RecordPriceConfig>;
+using RecordQty = StrongType<RecordQtyConfig>;
+using RecordName = StrongType<RecordNameConfig>;
+
+using Records = StrongSoA<RecordId, RecordPrice, RecordQty>;
+
+TEST(StrongSoA, push_back_and_columns) {
+  Records records;
+  ASSERT_TRUE(records.empty());
+  for (int i = 0; i < 100; ++i) {
+    records.push_back(RecordId{i}, RecordPrice{i * 0.5}, RecordQty{i % 7});
+  }
+  ASSERT_EQ(records.size(), 100);
+  ASSERT_GE(records.capacity(), 100);
+
+  const std::span<RecordPrice> prices = records.column<RecordPrice>();
+  ASSERT_EQ(prices.size(), 100);
+  ASSERT_EQ(prices[10], RecordPrice{5.0});
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(prices.data()) % 64, 0);
+  ASSERT_EQ(records.column<0>()[99], RecordId{99});
+  // the columns work with the bulk algorithms
+  ASSERT_EQ(strong::count_equal(std::span<const RecordQty>{
+                                    records.column<RecordQty>()},
+                                RecordQty{3}),
+            14);
+
+  records.reserve(1000);
+  ASSERT_GE(records.capacity(), 1000);
+  ASSERT_EQ(records.column<RecordQty>()[50], RecordQty{50 % 7});
+  records.pop_back();
+  ASSERT_EQ(records.size(), 99);
+  records.clear();
+  ASSERT_TRUE(records.empty());
+}
+
+TEST(StrongSoA, row_proxies) {
+  Records records;
+  records.push_back(RecordId{1}, RecordPrice{1.5}, RecordQty{10});
+  records.push_back(RecordId{2}, RecordPrice{2.5}, RecordQty{20});
+
+  auto row = records[1];
+  ASSERT_EQ(row.get<RecordId>(), RecordId{2});
+  row.get<RecordQty>() = RecordQty{21};
+  ASSERT_EQ(records.column<RecordQty>()[1], RecordQty{21});
+
+  auto [id, price, qty] = records[0];
+  price = RecordPrice{1.75};
+  ASSERT_EQ(id, RecordId{1});
+  ASSERT_EQ(records[0].get<RecordPrice>(), RecordPrice{1.75});
+
+  records[0] = std::tuple{RecordId{3}, RecordPrice{3.5}, RecordQty{30}};
+  ASSERT_EQ(records[0].values(),
+            std::tuple(RecordId{3}, RecordPrice{3.5}, RecordQty{30}));
+
+  const Records& view = records;
+  int rows = 0;
+  for (const auto [constId, constPrice, constQty] : view) {
+    static_assert(std::is_same_v<decltype(constQty), const RecordQty&>);
+    ASSERT_EQ(constId, records.column<RecordId>()[rows++]);
+  }
+  ASSERT_EQ(rows, 2);
+  ASSERT_EQ(view.end() - view.begin(), 2);
+}
+
+TEST(StrongSoA, sort_and_permute) {
+  Records records;
+  for (int i = 0; i < 1000; ++i) {
+    records.push_back(RecordId{i}, RecordPrice{static_cast<double>(i % 10)},
+                      RecordQty{i});
+  }
+  records.sort_by<RecordPrice>(std::greater<>{});
+  for (int i = 0; i < 1000; ++i) {
+    const auto row = records[static_cast<std::size_t>(i)];
+    // rows stay together and equal keys keep their order
+    ASSERT_EQ(row.get<RecordQty>().get(), row.get<RecordId>().get());
+    ASSERT_EQ(row.get<RecordPrice>(), RecordPrice{9.0 - i / 100});
+    if (i % 100 != 0) {
+      ASSERT_LT(records[static_cast<std::size_t>(i) - 1].get<RecordId>(),
+                row.get<RecordId>());
+    }
+  }
+
+  const std::vector<std::size_t> reverse = [&] {
+    std::vector<std::size_t> order(records.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      order[i] = order.size() - 1 - i;
+    }
+    return order;
+  }();
+  const auto last = records[999].values();
+  records.permute(reverse);
+  ASSERT_EQ(records[0].values(), last);
+
+  const std::vector<std::size_t> duplicate(1000, 0);
+  ASSERT_THROW(records.permute(duplicate), std::invalid_argument);
+  ASSERT_THROW(records.permute(std::vector<std::size_t>{0}),
+               std::invalid_argument);
+}
+
+TEST(StrongSoA, non_trivial_columns) {
+  StrongSoA<RecordId, RecordName> names;
+  for (int i = 0; i < 100; ++i) {
+    names.push_back(RecordId{i},
+                    RecordName{"a long name, not in the small buffer " +
+                               std::to_string(i)});
+  }
+  auto copy = names;
+  names.sort_by<RecordName>();
+  ASSERT_EQ(names[0].get<RecordName>().get(),
+            "a long name, not in the small buffer 0");
+  ASSERT_EQ(names[1].get<RecordId>(), RecordId{1});
+  ASSERT_EQ(names[2].get<RecordId>(), RecordId{10});
+  ASSERT_EQ(copy[2].get<RecordId>(), RecordId{2});
+
+  auto moved = std::move(copy);
+  ASSERT_EQ(moved.size(), 100);
+  ASSERT_TRUE(copy.empty());
+  copy = moved;
+  ASSERT_EQ(copy[99].get<RecordName>(), moved[99].get<RecordName>());
+}
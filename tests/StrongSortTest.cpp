@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongSort.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename T>
+struct SortKeyConfig {
+  using underlyingType = T;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+template <typename T>
+using SortKey = StrongType<SortKeyConfig<T>>;
+
+struct UnorderedConfig {
+  using underlyingType = std::int64_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Unordered = StrongType<UnorderedConfig>;
+
+template <typename T>
+concept isSortable = requires(std::vector<T>& values) {
+  strong::sort(values);
+  strong::stable_sort(strong::par, values);
+};
+
+static_assert(isSortable<SortKey<std::int64_t>>);
+static_assert(isSortable<SortKey<std::string>>);
+static_assert(!isSortable<Unordered>);
+static_assert(strong::detail::isRadixSortable<SortKey<double>>);
+static_assert(!strong::detail::isRadixSortable<SortKey<bool>>);
+static_assert(!strong::detail::isRadixSortable<SortKey<std::string>>);
+
+namespace {
+template <typename T>
+auto randomValues(std::size_t count) -> std::vector<T> {
+  using type = typename T::type;
+  std::mt19937_64 random{count};
+  std::vector<T> values;
+  values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if constexpr (std::is_floating_point_v<type>) {
+      values.emplace_back(
+          std::uniform_real_distribution<type>{-1e6, 1e6}(random));
+    } else {
+      values.emplace_back(static_cast<type>(random()));
+    }
+  }
+  return values;
+}
+
+// sizes below and above the radix threshold and the per thread chunk
+constexpr std::size_t sizes[] = {0, 1, 2, 255, 256, 1000, 100'000};
+
+template <typename T>
+void compareWithStdSort() {
+  for (const auto size : sizes) {
+    auto expected = randomValues<T>(size);
+    auto sorted = expected;
+    auto stable = expected;
+    auto parallel = expected;
+    std::sort(expected.begin(), expected.end());
+    strong::sort(sorted);
+    strong::stable_sort(std::span{stable});
+    strong::sort(strong::parallel_policy{4}, parallel);
+    ASSERT_EQ(sorted, expected);
+    ASSERT_EQ(stable, expected);
+    ASSERT_EQ(parallel, expected);
+  }
+}
+}  // namespace
+
+TEST(StrongSort, int8) { compareWithStdSort<SortKey<std::int8_t>>(); }
+TEST(StrongSort, uint16) { compareWithStdSort<SortKey<std::uint16_t>>(); }
+TEST(StrongSort, int32) { compareWithStdSort<SortKey<std::int32_t>>(); }
+TEST(StrongSort, int64) { compareWithStdSort<SortKey<std::int64_t>>(); }
+TEST(StrongSort, uint64) { compareWithStdSort<SortKey<std::uint64_t>>(); }
+TEST(StrongSort, float) { compareWithStdSort<SortKey<float>>(); }
+TEST(StrongSort, double) { compareWithStdSort<SortKey<double>>(); }
+
+TEST(StrongSort, sequential_ids) {
+  // only the low bytes differ, the other passes are skipped
+  using Id = SortKey<std::int64_t>;
+  std::vector<Id> ids;
+  for (std::int64_t i = 5000; i > 0; --i) {
+    ids.emplace_back(i);
+  }
+  strong::sort(ids);
+  ASSERT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+  ASSERT_EQ(ids.front(), Id{1});
+  ASSERT_EQ(ids.back(), Id{5000});
+}
+
+TEST(StrongSort, float_stability) {
+  using Value = SortKey<double>;
+  const auto infinity = std::numeric_limits<double>::infinity();
+  std::vector<Value> values;
+  for (int i = 0; i < 10000; ++i) {
+    values.emplace_back(i % 2 == 0 ? 0.0 : -0.0);
+    values.emplace_back(static_cast<double>(i % 7) - 3.5);
+  }
+  values.emplace_back(infinity);
+  values.emplace_back(-infinity);
+  auto parallel = values;
+
+  strong::stable_sort(values);
+  strong::stable_sort(strong::parallel_policy{3}, parallel);
+  for (const auto* sorted : {&values, &parallel}) {
+    ASSERT_TRUE(std::is_sorted(sorted->begin(), sorted->end()));
+    ASSERT_EQ(sorted->front(), Value{-infinity});
+    ASSERT_EQ(sorted->back(), Value{infinity});
+    // -0.0 and 0.0 compare equal, so they keep their alternating order
+    const auto zero = std::find(sorted->begin(), sorted->end(), Value{0.0});
+    for (std::size_t i = 0; i < 10000; ++i) {
+      ASSERT_EQ(std::signbit(zero[static_cast<std::ptrdiff_t>(i)].get()),
+                i % 2 == 1);
+    }
+  }
+}
+
+TEST(StrongSort, comparison_fallback) {
+  using Name = SortKey<std::string>;
+  std::vector<Name> names;
+  std::mt19937 random{7};
+  for (int i = 0; i < 20'000; ++i) {
+    names.emplace_back(std::to_string(random() % 5000));
+  }
+  auto expected = names;
+  std::stable_sort(expected.begin(), expected.end());
+  auto sorted = names;
+  strong::sort(sorted);
+  ASSERT_EQ(sorted, expected);
+  strong::stable_sort(strong::parallel_policy{3}, names);
+  ASSERT_EQ(names, expected);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongSpan.h>
+
+#include <array>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct ColumnIdConfig {
+  using underlyingType = long;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using ColumnId = StrongType<ColumnIdConfig>;
+
+class ExtendedColumnId : public ColumnId {
+ public:
+  using ColumnId::ColumnId;
+  [[nodiscard]] auto next() const -> ExtendedColumnId {
+    return ExtendedColumnId{get() + 1};
+  }
+};
+
+class TaggedColumnId : public ColumnId {
+ public:
+  using ColumnId::ColumnId;
+
+ private:
+  int tag = 0;
+};
+
+struct ScoreConfig : ColumnIdConfig {
+  using underlyingType = int;
+  using validator = strong::InRange<1, 100>;
+};
+using Score = StrongType<ScoreConfig>;
+
+template <typename T>
+concept isViewable = requires(std::span<T> values) {
+  strong::as_underlying_span(values);
+};
+template <typename Strong, typename U>
+concept isStrongViewable = requires(std::span<U> values) {
+  strong::as_strong_span<Strong>(values);
+};
+template <typename Strong, typename U>
+concept isUncheckedStrongViewable = requires(std::span<U> values) {
+  strong::as_strong_span<Strong>(strong::unchecked, values);
+};
+template <typename T>
+concept isRangeViewable = requires(std::vector<T>& values) {
+  strong::as_underlying_span(values);
+};
+
+static_assert(isLayoutCompatibleStrongType<ColumnId>);
+static_assert(isLayoutCompatibleStrongType<ExtendedColumnId>);
+static_assert(!isLayoutCompatibleStrongType<TaggedColumnId>);
+static_assert(!isLayoutCompatibleStrongType<long>);
+static_assert(isViewable<ColumnId>);
+static_assert(isViewable<const ExtendedColumnId>);
+static_assert(!isViewable<TaggedColumnId>);
+// a mutable view would write past the validator and a strong view would skip
+// it, only const views and trusted values with strong::unchecked are allowed
+static_assert(isLayoutCompatibleStrongType<Score>);
+static_assert(!isViewable<Score>);
+static_assert(isViewable<const Score>);
+static_assert(!isRangeViewable<Score>);
+static_assert(isRangeViewable<ColumnId>);
+static_assert(isStrongViewable<ColumnId, long>);
+static_assert(!isStrongViewable<Score, int>);
+static_assert(!isStrongViewable<Score, const int>);
+static_assert(isUncheckedStrongViewable<Score, const int>);
+static_assert(std::is_same_v<decltype(strong::as_underlying_span(
+                                 std::declval<std::span<const ColumnId, 4>>())),
+                             std::span<const long, 4>>);
+static_assert(std::is_same_v<decltype(strong::as_strong_span<ColumnId>(
+                                 std::declval<std::span<long>>())),
+                             std::span<ColumnId>>);
+
+TEST(StrongSpan, underlying_view) {
+  std::vector<ColumnId> ids{ColumnId{1}, ColumnId{2}, ColumnId{3}};
+  auto values = strong::as_underlying_span(ids);
+  ASSERT_EQ(static_cast<const void*>(values.data()),
+            static_cast<const void*>(ids.data()));
+  ASSERT_EQ(std::accumulate(values.begin(), values.end(), 0L), 6);
+  values[1] = 20;
+  ASSERT_EQ(ids[1], ColumnId{20});
+
+  const auto& constIds = ids;
+  auto constValues = strong::as_underlying_span(constIds);
+  static_assert(std::is_same_v<decltype(constValues), std::span<const long>>);
+  ASSERT_EQ(constValues.size(), 3);
+}
+
+TEST(StrongSpan, strong_view) {
+  std::array<long, 3> values{4, 5, 6};
+  auto ids = strong::as_strong_span<ExtendedColumnId>(values);
+  ASSERT_EQ(ids.size(), 3);
+  ASSERT_EQ(ids[2].next().get(), 7);
+  ids[0] = ExtendedColumnId{40};
+  ASSERT_EQ(values[0], 40);
+}
+
+TEST(StrongSpan, validated_view) {
+  const std::vector<Score> scores{Score{1}, Score{50}, Score{100}};
+  const auto values = strong::as_underlying_span(scores);
+  static_assert(std::is_same_v<decltype(values), const std::span<const int>>);
+  ASSERT_EQ(values[1], 50);
+
+  const std::vector<int> trusted{10, 20};
+  const auto view = strong::as_strong_span<Score>(strong::unchecked, trusted);
+  static_assert(std::is_same_v<decltype(view), const std::span<const Score>>);
+  ASSERT_EQ(view[1], Score{20});
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongFixedString.h>
+#include <StrongTypes/StrongStaticMap.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+struct VenueConfig {
+  using underlyingType = std::int32_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Venue = StrongType<VenueConfig>;
+
+struct ErrorCodeConfig {
+  using underlyingType = std::uint16_t;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using ErrorCode = StrongType<ErrorCodeConfig>;
+
+struct RegionConfig : ErrorCodeConfig {
+  using underlyingType = strong::FixedString<8>;
+};
+using Region = StrongType<RegionConfig>;
+
+struct OpaqueConfig : ErrorCodeConfig {
+  static constexpr bool equal = false;
+  static constexpr bool notEqual = false;
+};
+using Opaque = StrongType<OpaqueConfig>;
+
+static_assert(strong::isStaticMapKey<Venue>);
+static_assert(strong::isStaticMapKey<ErrorCode>);
+static_assert(strong::isStaticMapKey<Region>);
+static_assert(!strong::isStaticMapKey<Opaque>);
+
+constexpr auto venues = strong::make_static_map<Venue, std::string_view>({
+    {Venue{7}, "XNYS"},
+    {Venue{2}, "XNAS"},
+    {Venue{40}, "XLON"},
+    {Venue{-3}, "XETR"},
+    {Venue{11}, "XPAR"},
+});
+static_assert(decltype(venues)::is_ordered);
+static_assert(venues.size() == 5);
+static_assert(*venues.find(Venue{7}) == "XNYS");
+static_assert(venues.at(Venue{-3}) == "XETR");
+static_assert(venues.find(Venue{8}) == nullptr);
+static_assert(!venues.contains(Venue{41}));
+static_assert(!venues.contains(Venue{-4}));
+// the ordered layout needs nothing besides the keys and values
+static_assert(sizeof(venues) ==
+              sizeof(std::pair<std::array<Venue, 5>,
+                               std::array<std::string_view, 5>>));
+
+constexpr auto errors = strong::make_static_map<ErrorCode, std::string_view>({
+    {ErrorCode{404}, "not found"},
+    {ErrorCode{500}, "internal"},
+    {ErrorCode{503}, "unavailable"},
+});
+static_assert(!decltype(errors)::is_ordered);
+static_assert(errors.at(ErrorCode{503}) == "unavailable");
+static_assert(!errors.contains(ErrorCode{200}));
+
+constexpr auto regions = strong::make_static_map<Region, int>({
+    {Region{"emea"}, 1},
+    {Region{"apac"}, 2},
+    {Region{"amer"}, 3},
+});
+static_assert(regions.at(Region{"apac"}) == 2);
+static_assert(!regions.contains(Region{"latam"}));
+
+template <typename Key, std::size_t N>
+constexpr auto makeEntries() {
+  // every third value, so the gaps are missing keys
+  return []<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array{std::pair{
+        Key{static_cast<typename Key::type>(3 * I + 1)}, std::size_t{I}}...};
+  }(std::make_index_sequence<N>{});
+}
+
+template <typename Key, std::size_t N>
+void checkAllKeys() {
+  static constexpr strong::static_map<Key, std::size_t, N> map{
+      makeEntries<Key, N>()};
+  for (std::size_t i = 0; i < N; ++i) {
+    const Key key{static_cast<typename Key::type>(3 * i + 1)};
+    ASSERT_EQ(map.at(key), i);
+    ASSERT_FALSE(map.contains(Key{static_cast<typename Key::type>(3 * i)}));
+    ASSERT_FALSE(
+        map.contains(Key{static_cast<typename Key::type>(3 * i + 2)}));
+  }
+}
+
+TEST(StaticMap, eytzinger_all_sizes) {
+  checkAllKeys<Venue, 1>();
+  checkAllKeys<Venue, 2>();
+  checkAllKeys<Venue, 7>();
+  checkAllKeys<Venue, 8>();
+  checkAllKeys<Venue, 9>();
+  checkAllKeys<Venue, 300>();
+}
+
+TEST(StaticMap, perfect_hash_all_sizes) {
+  checkAllKeys<ErrorCode, 1>();
+  checkAllKeys<ErrorCode, 5>();
+  checkAllKeys<ErrorCode, 64>();
+  checkAllKeys<ErrorCode, 300>();
+}
+
+TEST(StaticMap, at_throws) {
+  ASSERT_THROW(static_cast<void>(venues.at(Venue{1})), std::out_of_range);
+  ASSERT_THROW(static_cast<void>(errors.at(ErrorCode{1})), std::out_of_range);
+}
+
+TEST(StaticMap, duplicate_key) {
+  using VenueMap = strong::static_map<Venue, int, 3>;
+  using ErrorMap = strong::static_map<ErrorCode, int, 3>;
+  ASSERT_THROW(static_cast<void>(VenueMap{{{{Venue{1}, 1},
+                                            {Venue{2}, 2},
+                                            {Venue{1}, 3}}}}),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(ErrorMap{{{{ErrorCode{5}, 1},
+                                            {ErrorCode{5}, 2},
+                                            {ErrorCode{6}, 3}}}}),
+               std::invalid_argument);
+}
+
+TEST(StaticMap, runtime_build) {
+  // the same map can be built at runtime, e.g. from a configuration
+  const std::int32_t base = 100;
+  const strong::static_map<Venue, int, 2> map{
+      {{{Venue{base}, 1}, {Venue{base + 1}, 2}}}};
+  ASSERT_EQ(map.at(Venue{101}), 2);
+  ASSERT_EQ(map.find(Venue{102}), nullptr);
+}
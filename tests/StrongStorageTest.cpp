@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongHashMap.h>
+#include <StrongTypes/StrongSort.h>
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// a database id over long whose values never exceed 2^32
+struct CompactIdConfig {
+  using underlyingType = long;
+  using storageType = std::uint32_t;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = true;
+  static constexpr bool hash = true;
+};
+using CompactId = StrongType<CompactIdConfig>;
+
+// an enum like value over int
+struct ColorConfig {
+  using underlyingType = int;
+  using validator = strong::InRange<0, 200>;
+  static constexpr bool compact = true;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool bitwise = true;
+};
+using Color = StrongType<ColorConfig>;
+
+struct OffsetConfig {
+  using underlyingType = long long;
+  using validator = strong::InRange<-40'000, 40'000>;
+  static constexpr bool compact = true;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool addSubtract = true;
+  static constexpr bool scale = true;
+};
+using Offset = StrongType<OffsetConfig>;
+
+static_assert(sizeof(CompactId) == sizeof(std::uint32_t));
+static_assert(sizeof(Color) == sizeof(std::uint8_t));
+static_assert(sizeof(Offset) == sizeof(std::int32_t));
+static_assert(std::is_same_v<Color::storage_type, std::uint8_t>);
+static_assert(std::is_same_v<Offset::storage_type, std::int32_t>);
+static_assert(std::is_trivially_copyable_v<CompactId>);
+static_assert(std::is_trivially_default_constructible_v<CompactId>);
+// the logical type is what get() presents
+static_assert(std::is_same_v<decltype(std::declval<const CompactId&>().get()),
+                             long>);
+static_assert(std::is_same_v<decltype(std::declval<Color>().get()), int>);
+// a narrower storage can't be viewed as its underlying type
+static_assert(!isLayoutCompatibleStrongType<CompactId>);
+static_assert(!isLayoutCompatibleStrongType<Color>);
+static_assert(Color{200}.get() == 200);
+
+// strong::unchecked doesn't check the storage type, a value which doesn't fit
+// is no constant expression instead of being truncated
+template <long value>
+concept isUncheckedConstant = requires() {
+  typename std::integral_constant<
+      long, CompactId{strong::unchecked, value}.get()>;
+};
+static_assert(isUncheckedConstant<4'000'000'000>);
+static_assert(!isUncheckedConstant<5'000'000'000>);
+static_assert(!isUncheckedConstant<-1>);
+
+TEST(StrongStorage, stores_and_presents_logical_type) {
+  const CompactId id{4'000'000'000L};
+  ASSERT_EQ(id.get(), 4'000'000'000L);
+  ASSERT_EQ(CompactId{0}.get(), 0);
+  ASSERT_THROW(CompactId{-1}, std::invalid_argument);
+  ASSERT_THROW(CompactId{1L << 32}, std::invalid_argument);
+  ASSERT_THROW(Color{201}, std::invalid_argument);
+  ASSERT_THROW(Offset{-40'001}, std::invalid_argument);
+  ASSERT_EQ(Offset{-40'000}.get(), -40'000);
+}
+
+TEST(StrongStorage, comparisons) {
+  ASSERT_LT(CompactId{3'000'000'000L}, CompactId{4'000'000'000L});
+  ASSERT_EQ(CompactId{7}, CompactId{7});
+  // comparisons with the underlying type use the logical value
+  ASSERT_TRUE(CompactId{5} > -1L);
+  ASSERT_TRUE(CompactId{3'000'000'000L} == 3'000'000'000L);
+  ASSERT_EQ(CompactId{5} <=> 6L, std::strong_ordering::less);
+  ASSERT_LT(Offset{-5}, Offset{3});
+}
+
+TEST(StrongStorage, arithmetic) {
+  const Offset offset{-30'000};
+  ASSERT_EQ((offset + Offset{100}).get(), -29'900);
+  ASSERT_EQ((-offset).get(), 30'000);
+  ASSERT_EQ((Offset{-3} * 4LL).get(), -12);
+  // results outside of the range are rejected like in the constructor
+  ASSERT_THROW(static_cast<void>(offset + offset), std::invalid_argument);
+  // ~ of the logical int, not of the stored byte
+  ASSERT_EQ((Color{0b1010} & Color{0b0110}).get(), 0b0010);
+  ASSERT_THROW(static_cast<void>(~Color{0}), std::invalid_argument);
+}
+
+TEST(StrongStorage, containers_and_sort) {
+  std::vector<CompactId> ids;
+  for (long i = 0; i < 1000; ++i) {
+    ids.emplace_back(static_cast<long>((i * 7919) % 1000) + 3'000'000'000L);
+  }
+  strong::sort(ids);
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    ASSERT_EQ(ids[i].get(), static_cast<long>(i) + 3'000'000'000L);
+  }
+
+  StrongHashMap<CompactId, int> index;
+  index[CompactId{4'000'000'000L}] = 1;
+  ASSERT_EQ(index.at(CompactId{4'000'000'000L}), 1);
+  ASSERT_EQ(std::hash<CompactId>{}(CompactId{42}),
+            strong::hashValue(42L));
+}
@@ -2,6 +2,9 @@
 
 #include <StrongTypes/StrongTypes.h>
 
+#include <memory>
+#include <string>
+
 struct DatabaseIdConfig {
   using underlyingType = long;
 
@@ -19,6 +22,23 @@ struct DatabaseIdConfig {
 
 using DbId = StrongType<DatabaseIdConfig>;
 static_assert(sizeof(DbId) == sizeof(DatabaseIdConfig::underlyingType));
+static_assert(std::is_trivially_copyable_v<DbId>);
+static_assert(std::is_trivially_destructible_v<DbId>);
+static_assert(std::is_trivially_default_constructible_v<DbId>);
+static_assert(std::is_nothrow_constructible_v<DbId, long>);
+static_assert(std::is_nothrow_move_constructible_v<DbId>);
+static_assert(noexcept(std::declval<const DbId&>().get()));
+static_assert(noexcept(std::declval<const DbId&>() <=> std::declval<DbId>()));
+static_assert(noexcept(std::declval<const DbId&>() == std::declval<DbId>()));
+static_assert(noexcept(std::declval<const DbId&>() < std::declval<DbId>()));
+static_assert(DbId{1}.get() == 1);
+static_assert(DbId{1} == DbId{1});
+static_assert(DbId{1} != DbId{2});
+static_assert(DbId{1} < DbId{2});
+static_assert(DbId{1} <= DbId{1});
+static_assert(DbId{2} > DbId{1});
+static_assert(DbId{2} >= DbId{2});
+static_assert((DbId{1} <=> DbId{2}) < 0);
 TEST(DbId, creation_and_get) {
   DbId id{1};
   ASSERT_EQ(id.get(), 1);
@@ -57,6 +77,7 @@ static_assert(!std::is_same_v<DbId2, DbId>,
               "Both strong types shouldn't be the same");
 
 static_assert(!std::equality_comparable_with<DbId, DbId2>);
+static_assert((DbId2{1} <=> 2L) < 0);
 static_assert(!std::three_way_comparable_with<DbId, DbId2>);
 
 struct OldTypeConfig {
@@ -74,6 +95,14 @@ struct OldTypeConfig {
 };
 
 using OldType = StrongType<OldTypeConfig>;
+static_assert(std::is_trivially_copyable_v<OldType>);
+static_assert(noexcept(std::declval<const OldType&>() < 1));
+static_assert(OldType{1} < OldType{2});
+static_assert(OldType{1} == 1);
+static_assert(OldType{1} <= 1);
+static_assert(OldType{2} > 1);
+static_assert(OldType{2} >= 2);
+static_assert(OldType{1} != 2);
 
 TEST(OldType, creation_and_get) {
   OldType id{1};
@@ -233,3 +262,81 @@ static_assert(
     !isNotEqualComparable<StrongType<NoUnderlyingTypeComparision>, int>);
 static_assert(
     !isNotEqualComparable<StrongType<NoUnderlyingTypeComparision>, int>);
+
+struct NameConfig {
+  using underlyingType = std::string;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+
+using Name = StrongType<NameConfig>;
+static_assert(!std::is_trivially_copyable_v<Name>);
+static_assert(std::is_nothrow_move_constructible_v<Name>);
+static_assert(std::is_nothrow_constructible_v<Name, std::string&&>);
+static_assert(!std::is_nothrow_constructible_v<Name, const std::string&>);
+static_assert(
+    std::is_same_v<decltype(std::declval<Name>().get()), std::string>);
+
+TEST(Name, move_construction) {
+  std::string value(64, 'a');
+  const auto* buffer = value.data();
+  Name name{std::move(value)};
+  ASSERT_EQ(name.get().data(), buffer);
+}
+
+TEST(Name, in_place_construction) {
+  Name name{std::in_place, 3, 'b'};
+  ASSERT_EQ(name.get(), "bbb");
+}
+
+TEST(Name, move_out_of_temporary) {
+  Name name{std::string(64, 'c')};
+  const auto* buffer = name.get().data();
+  std::string value = std::move(name).get();
+  ASSERT_EQ(value.data(), buffer);
+}
+
+struct UniqueConfig {
+  using underlyingType = std::unique_ptr<int>;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+
+using Unique = StrongType<UniqueConfig>;
+static_assert(!std::is_copy_constructible_v<Unique>);
+static_assert(!std::is_constructible_v<Unique, const std::unique_ptr<int>&>);
+static_assert(std::is_nothrow_move_constructible_v<Unique>);
+static_assert(std::is_nothrow_move_assignable_v<Unique>);
+
+TEST(Unique, move_only) {
+  Unique first{std::make_unique<int>(1)};
+  Unique second{std::in_place, new int{2}};
+  ASSERT_EQ(*first.get(), 1);
+  ASSERT_EQ(*second.get(), 2);
+  ASSERT_NE(first, second);
+
+  Unique moved{std::move(first)};
+  ASSERT_EQ(*moved.get(), 1);
+  second = std::move(moved);
+  ASSERT_EQ(*second.get(), 1);
+
+  std::unique_ptr<int> extracted = std::move(second).get();
+  ASSERT_EQ(*extracted, 1);
+  ASSERT_EQ(second.get(), nullptr);
+}
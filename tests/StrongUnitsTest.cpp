@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongTypes.h>
+#include <StrongTypes/StrongUnits.h>
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct Duration {};
+struct Money {};
+struct DataSize {};
+
+struct SecondsConfig {
+  using underlyingType = std::int64_t;
+  using unit = strong::Unit<Duration>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Seconds = StrongType<SecondsConfig>;
+
+struct MillisecondsConfig : SecondsConfig {
+  using unit = strong::Unit<Duration, std::milli>;
+};
+using Milliseconds = StrongType<MillisecondsConfig>;
+
+struct MicrosecondsConfig : SecondsConfig {
+  using unit = strong::Unit<Duration, std::micro>;
+};
+using Microseconds = StrongType<MicrosecondsConfig>;
+
+struct ShortMillisecondsConfig : MillisecondsConfig {
+  using underlyingType = std::int32_t;
+};
+using ShortMilliseconds = StrongType<ShortMillisecondsConfig>;
+
+struct FloatSecondsConfig : SecondsConfig {
+  using underlyingType = double;
+};
+using FloatSeconds = StrongType<FloatSecondsConfig>;
+
+// at most a day
+struct TimeoutConfig : MillisecondsConfig {
+  using validator = strong::InRange<0, 86'400'000>;
+};
+using Timeout = StrongType<TimeoutConfig>;
+
+struct CentsConfig : SecondsConfig {
+  using unit = strong::Unit<Money, std::centi>;
+};
+using Cents = StrongType<CentsConfig>;
+
+struct BytesConfig : SecondsConfig {
+  using underlyingType = std::uint64_t;
+  using unit = strong::Unit<DataSize>;
+};
+using Bytes = StrongType<BytesConfig>;
+
+struct KilobytesConfig : BytesConfig {
+  using unit = strong::Unit<DataSize, std::kilo>;
+};
+using Kilobytes = StrongType<KilobytesConfig>;
+
+struct KibibytesConfig : BytesConfig {
+  using unit = strong::Unit<DataSize, std::ratio<1024>>;
+};
+using Kibibytes = StrongType<KibibytesConfig>;
+
+struct PlainMillisecondsConfig : SecondsConfig {
+  using unit = void;
+};
+
+static_assert(isUnitEnabled<MillisecondsConfig>);
+static_assert(!isUnitEnabled<PlainMillisecondsConfig>);
+static_assert(isUnitConvertible<Milliseconds, Microseconds>);
+static_assert(isUnitConvertible<Milliseconds, FloatSeconds>);
+static_assert(isUnitConvertible<Kibibytes, Kilobytes>);
+// other families, floating point into integers and types without a unit
+static_assert(!isUnitConvertible<Milliseconds, Cents>);
+static_assert(!isUnitConvertible<Bytes, Seconds>);
+static_assert(!isUnitConvertible<FloatSeconds, Milliseconds>);
+static_assert(
+    !isUnitConvertible<Milliseconds, StrongType<PlainMillisecondsConfig>>);
+// a unit converts explicitly, related types stay incomparable
+static_assert(!std::equality_comparable_with<Milliseconds, Microseconds>);
+static_assert(!std::is_convertible_v<Milliseconds, Microseconds>);
+
+// conversions are constant expressions
+static_assert(strong::strong_cast<Microseconds>(Milliseconds{3}).get() ==
+              3000);
+static_assert(strong::strong_cast<Seconds>(Milliseconds{-1999}).get() == -1);
+static_assert(strong::strong_cast<Kibibytes>(Kilobytes{1024}).get() == 1000);
+
+// the bounds are found at compile time, an overflow isn't a constant
+template <std::int64_t value>
+concept isConstantCast = requires() {
+  typename std::integral_constant<
+      std::int64_t,
+      strong::strong_cast<Microseconds>(Milliseconds{value}).get()>;
+};
+constexpr auto maxMilliseconds =
+    std::numeric_limits<std::int64_t>::max() / 1000;
+static_assert(isConstantCast<maxMilliseconds>);
+static_assert(!isConstantCast<maxMilliseconds + 1>);
+static_assert(isConstantCast<-maxMilliseconds>);
+static_assert(!isConstantCast<-maxMilliseconds - 1>);
+
+TEST(StrongUnits, strong_cast) {
+  ASSERT_EQ(strong::strong_cast<Milliseconds>(Microseconds{2999}),
+            Milliseconds{2});
+  ASSERT_EQ(strong::strong_cast<Milliseconds>(Microseconds{-2999}),
+            Milliseconds{-2});
+  ASSERT_EQ(strong::strong_cast<Milliseconds>(Milliseconds{7}),
+            Milliseconds{7});
+  ASSERT_EQ(strong::strong_cast<Kilobytes>(Kibibytes{1000}), Kilobytes{1024});
+  ASSERT_EQ(strong::strong_cast<Bytes>(Kibibytes{3}), Bytes{3072});
+  ASSERT_DOUBLE_EQ(strong::strong_cast<FloatSeconds>(Milliseconds{1500}).get(),
+                   1.5);
+  ASSERT_DOUBLE_EQ(strong::strong_cast<FloatSeconds>(FloatSeconds{0.25}).get(),
+                   0.25);
+}
+
+TEST(StrongUnits, overflow) {
+  ASSERT_EQ(strong::strong_cast<Microseconds>(Milliseconds{maxMilliseconds}),
+            Microseconds{maxMilliseconds * 1000});
+  ASSERT_THROW(static_cast<void>(strong::strong_cast<Microseconds>(
+                   Milliseconds{maxMilliseconds + 1})),
+               std::overflow_error);
+  // into a narrower type
+  ASSERT_EQ(strong::strong_cast<ShortMilliseconds>(Seconds{2'000'000}),
+            ShortMilliseconds{2'000'000'000});
+  ASSERT_THROW(static_cast<void>(
+                   strong::strong_cast<ShortMilliseconds>(Seconds{3'000'000})),
+               std::overflow_error);
+  ASSERT_THROW(static_cast<void>(
+                   strong::strong_cast<ShortMilliseconds>(Seconds{-3'000'000})),
+               std::overflow_error);
+  // unsigned
+  constexpr auto maxKibibytes =
+      std::numeric_limits<std::uint64_t>::max() / 1024;
+  ASSERT_EQ(strong::strong_cast<Bytes>(Kibibytes{maxKibibytes}).get(),
+            maxKibibytes * 1024);
+  ASSERT_THROW(static_cast<void>(
+                   strong::strong_cast<Bytes>(Kibibytes{maxKibibytes + 1})),
+               std::overflow_error);
+  // the validator of the target still applies
+  ASSERT_EQ(strong::strong_cast<Timeout>(Seconds{60}).get(), 60'000);
+  ASSERT_THROW(static_cast<void>(strong::strong_cast<Timeout>(Seconds{-1})),
+               std::invalid_argument);
+}
+
+TEST(StrongUnits, convert) {
+  std::vector<Milliseconds> timestamps;
+  for (std::int64_t i = 0; i < 5000; ++i) {
+    timestamps.emplace_back(i * 7919 - 1'000'000);
+  }
+  const auto micros =
+      strong::convert<Microseconds>(std::span<const Milliseconds>{timestamps});
+  ASSERT_EQ(micros.size(), timestamps.size());
+  for (std::size_t i = 0; i < micros.size(); ++i) {
+    ASSERT_EQ(micros[i], strong::strong_cast<Microseconds>(timestamps[i]));
+  }
+
+  std::vector<Seconds> seconds(micros.size());
+  strong::convert(std::span<const Microseconds>{micros}, std::span{seconds});
+  for (std::size_t i = 0; i < seconds.size(); ++i) {
+    ASSERT_EQ(seconds[i], strong::strong_cast<Seconds>(timestamps[i]));
+  }
+  ASSERT_THROW(strong::convert(std::span<const Microseconds>{micros},
+                               std::span{seconds}.first(10)),
+               std::invalid_argument);
+}
+
+TEST(StrongUnits, convert_overflow) {
+  std::vector<Seconds> seconds(3000, Seconds{1});
+  seconds[2500] = Seconds{3'000'000};
+  std::vector<ShortMilliseconds> millis(seconds.size(), ShortMilliseconds{0});
+  try {
+    strong::convert(std::span<const Seconds>{seconds}, std::span{millis});
+    FAIL() << "expected std::overflow_error";
+  } catch (const std::overflow_error& error) {
+    ASSERT_NE(std::string{error.what()}.find("offset 2500"),
+              std::string::npos);
+  }
+  // the chunks before the overflow are converted
+  ASSERT_EQ(millis[0], ShortMilliseconds{1000});
+  ASSERT_EQ(millis[2047], ShortMilliseconds{1000});
+}
+
+TEST(StrongUnits, convert_checked_target) {
+  // a target with a validator is converted value by value
+  const std::vector<Seconds> seconds{Seconds{1}, Seconds{60}, Seconds{3600}};
+  const auto timeouts =
+      strong::convert<Timeout>(std::span<const Seconds>{seconds});
+  ASSERT_EQ(timeouts[2].get(), 3'600'000);
+
+  const std::vector<Seconds> invalid{Seconds{1}, Seconds{-1}};
+  std::vector<Timeout> out(2, Timeout{0});
+  ASSERT_THROW(
+      strong::convert(std::span<const Seconds>{invalid}, std::span{out}),
+      std::invalid_argument);
+}
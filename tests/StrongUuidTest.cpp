@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongHashMap.h>
+#include <StrongTypes/StrongUuid.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+struct RequestIdConfig {
+  using underlyingType = strong::Uuid;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool hash = true;
+};
+using RequestId = StrongType<RequestIdConfig>;
+
+struct RequestIdV7Config : RequestIdConfig {
+  using validator = strong::Satisfies<[](const strong::Uuid& uuid) noexcept {
+    return uuid.version() == 7;
+  }>;
+};
+using RequestIdV7 = StrongType<RequestIdV7Config>;
+
+static_assert(sizeof(StrongUuid) == 16);
+static_assert(std::is_trivially_copyable_v<StrongUuid>);
+static_assert(strong::isUuidStrongType<RequestId>);
+
+TEST(StrongUuid, parse_and_format) {
+  constexpr std::string_view text = "01890a5d-ac96-774b-bcce-b302099a8057";
+  const auto uuid = strong::parseUuid(text);
+  ASSERT_TRUE(uuid.has_value());
+  ASSERT_EQ(uuid->get().bytes[0], 0x01);
+  ASSERT_EQ(uuid->get().bytes[15], 0x57);
+  ASSERT_EQ(uuid->get().version(), 7);
+  ASSERT_EQ(strong::toString(*uuid), text);
+
+  const auto upper =
+      strong::parseUuid<RequestId>("{01890A5D-AC96-774B-BCCE-B302099A8057}");
+  ASSERT_TRUE(upper.has_value());
+  ASSERT_EQ(upper->get(), uuid->get());
+}
+
+TEST(StrongUuid, parse_validated) {
+  const auto v7 =
+      strong::parseUuid<RequestIdV7>("01890a5d-ac96-774b-bcce-b302099a8057");
+  ASSERT_TRUE(v7.has_value());
+  ASSERT_EQ(v7->get().version(), 7);
+  // well formed, but rejected by the validator
+  ASSERT_FALSE(
+      strong::parseUuid<RequestIdV7>("01890a5d-ac96-474b-bcce-b302099a8057"));
+}
+
+TEST(StrongUuid, rejects_malformed_text) {
+  const std::string valid = "01890a5d-ac96-774b-bcce-b302099a8057";
+  ASSERT_FALSE(strong::parseUuid(valid.substr(1)));
+  ASSERT_FALSE(strong::parseUuid(valid + "0"));
+  ASSERT_FALSE(strong::parseUuid("{" + valid));
+  ASSERT_FALSE(strong::parseUuid("01890a5dac96-774b-bcce-b302099a8057-"));
+  for (std::size_t i = 0; i < valid.size(); ++i) {
+    for (const char c : {'g', 'G', '-', ' ', '/', ':', '@', '`', '\xff'}) {
+      if (c == valid[i]) {
+        continue;
+      }
+      auto text = valid;
+      text[i] = c;
+      ASSERT_FALSE(strong::parseUuid(text)) << text;
+    }
+  }
+}
+
+TEST(StrongUuid, matches_scalar_code) {
+  std::mt19937 random{7};
+  const std::string hex = "0123456789abcdefABCDEF";
+  for (int round = 0; round < 1000; ++round) {
+    std::string text(strong::uuidTextSize, '-');
+    for (std::size_t i = 0; i < text.size(); ++i) {
+      if (!strong::detail::isUuidDash(i)) {
+        text[i] = hex[random() % hex.size()];
+      }
+    }
+    strong::Uuid expected;
+    ASSERT_TRUE(strong::detail::parseUuidScalar(text.data(), expected));
+    const auto uuid = strong::parseUuid(text);
+    ASSERT_TRUE(uuid.has_value());
+    ASSERT_EQ(uuid->get(), expected);
+
+    std::string formatted(strong::uuidTextSize, '\0');
+    strong::detail::formatUuidScalar(expected, formatted.data());
+    ASSERT_EQ(strong::toString(*uuid), formatted);
+  }
+}
+
+TEST(StrongUuid, generate_v4) {
+  std::unordered_set<StrongUuid> seen;
+  for (int i = 0; i < 10'000; ++i) {
+    const auto uuid = strong::generateUuidV4();
+    ASSERT_EQ(uuid.get().version(), 4);
+    ASSERT_EQ(uuid.get().bytes[8] & 0xc0, 0x80);
+    ASSERT_TRUE(seen.insert(uuid).second);
+    ASSERT_EQ(strong::parseUuid(strong::toString(uuid)), uuid);
+  }
+}
+
+TEST(StrongUuid, generate_v7) {
+  const auto first = strong::generateUuidV7();
+  std::this_thread::sleep_for(std::chrono::milliseconds{2});
+  const auto second = strong::generateUuidV7<RequestId>();
+  ASSERT_EQ(first.get().version(), 7);
+  ASSERT_EQ(second.get().bytes[8] & 0xc0, 0x80);
+  // a later millisecond sorts after the earlier one
+  ASSERT_LT(first.get(), second.get());
+
+  StrongHashMap<RequestId, int> requests;
+  requests[second] = 1;
+  ASSERT_TRUE(requests.contains(second));
+}
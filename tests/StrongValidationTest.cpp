@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <StrongTypes/StrongAlgorithms.h>
+#include <StrongTypes/StrongSpan.h>
+#include <StrongTypes/StrongTypes.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct PercentConfig {
+  using underlyingType = int;
+  using validator = strong::InRange<0, 100>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+  static constexpr bool addSubtract = true;
+  static constexpr bool increment = true;
+};
+using Percent = StrongType<PercentConfig>;
+
+struct ProbabilityConfig {
+  using underlyingType = double;
+  using validator = strong::InRange<0.0, 1.0>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Probability = StrongType<ProbabilityConfig>;
+
+struct UserNameConfig {
+  using underlyingType = std::string;
+  using validator = strong::NonEmpty;
+
+  static constexpr bool spaceship = false;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = false;
+  static constexpr bool lessEqual = false;
+  static constexpr bool greaterThen = false;
+  static constexpr bool greaterEqual = false;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using UserName = StrongType<UserNameConfig>;
+
+struct EvenConfig {
+  using underlyingType = unsigned;
+  using validator = strong::Satisfies<[](unsigned value) {
+    return value % 2 == 0;
+  }>;
+
+  static constexpr bool spaceship = true;
+  static constexpr bool equal = true;
+  static constexpr bool notEqual = true;
+
+  static constexpr bool lessThen = true;
+  static constexpr bool lessEqual = true;
+  static constexpr bool greaterThen = true;
+  static constexpr bool greaterEqual = true;
+
+  static constexpr bool allowUnderlyingTypeInOperator = false;
+};
+using Even = StrongType<EvenConfig>;
+
+// bounds like InRange, but with a further rule
+struct EvenPercentValidator {
+  static constexpr int min = 0;
+  static constexpr int max = 100;
+
+  [[nodiscard]] static constexpr auto isValid(int value) noexcept -> bool {
+    return value >= min && value <= max && value % 2 == 0;
+  }
+};
+struct EvenPercentConfig : PercentConfig {
+  using validator = EvenPercentValidator;
+};
+using EvenPercent = StrongType<EvenPercentConfig>;
+
+static_assert(isValidationEnabled<PercentConfig>);
+static_assert(isAssumeEnabled<PercentConfig>);
+static_assert(!isAssumeEnabled<EvenConfig>);
+// a moved from std::string is empty
+static_assert(!isAssumeEnabled<UserNameConfig>);
+static_assert(sizeof(Percent) == sizeof(int));
+static_assert(std::is_trivially_copyable_v<Percent>);
+static_assert(!std::is_nothrow_constructible_v<Percent, int>);
+static_assert(
+    std::is_nothrow_constructible_v<Percent, strong::unchecked_t, int>);
+static_assert(!std::is_default_constructible_v<Percent>);
+
+template <typename T>
+concept hasMutableGet = requires(T& value) { value.get() = value.get(); };
+template <typename T>
+concept hasCompoundAddition = requires(T& value) { value += value; };
+template <typename T>
+concept hasIncrement = requires(T& value) { ++value; };
+// nothing can change the value of a valid Percent to an invalid one
+static_assert(!hasMutableGet<Percent>);
+static_assert(!hasCompoundAddition<Percent>);
+static_assert(!hasIncrement<Percent>);
+static_assert(Percent{42}.get() == 42);
+static_assert(!strong::makeChecked<Percent>(101).has_value());
+
+TEST(StrongValidation, throwing_constructor) {
+  ASSERT_EQ(Percent{0}.get(), 0);
+  ASSERT_EQ(Percent{100}.get(), 100);
+  ASSERT_THROW(Percent{-1}, std::invalid_argument);
+  ASSERT_THROW(Percent{101}, std::invalid_argument);
+  ASSERT_THROW(Probability{std::nan("")}, std::invalid_argument);
+  ASSERT_THROW(UserName{std::string{}}, std::invalid_argument);
+  ASSERT_THROW((UserName{std::in_place, 0, 'x'}), std::invalid_argument);
+  ASSERT_EQ((UserName{std::in_place, 3, 'x'}).get(), "xxx");
+  ASSERT_THROW(Even{3u}, std::invalid_argument);
+}
+
+TEST(StrongValidation, arithmetic_is_validated) {
+  const Percent sixty{60};
+  ASSERT_EQ((sixty - Percent{20}).get(), 40);
+  ASSERT_THROW(static_cast<void>(sixty + sixty), std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(-sixty), std::invalid_argument);
+}
+
+TEST(StrongValidation, checked_factory) {
+  ASSERT_EQ(strong::makeChecked<Percent>(50), Percent{50});
+  ASSERT_FALSE(strong::makeChecked<Percent>(-5));
+  ASSERT_FALSE(strong::makeChecked<Probability>(1.5));
+  ASSERT_FALSE(strong::makeChecked<UserName>(std::string{}));
+  ASSERT_EQ(strong::makeChecked<UserName>("alice")->get(), "alice");
+  ASSERT_EQ(strong::makeChecked<Even>(4u), Even{4u});
+}
+
+TEST(StrongValidation, unchecked_constructor) {
+  // trusted paths skip the validator
+  const Percent trusted{strong::unchecked, 42};
+  ASSERT_EQ(trusted.get(), 42);
+  const UserName name{strong::unchecked, std::string{"bob"}};
+  ASSERT_EQ(name.get(), "bob");
+}
+
+TEST(StrongValidation, moved_from) {
+  UserName name{std::string(32, 'x')};
+  const UserName moved{std::move(name)};
+  ASSERT_EQ(moved.get().size(), 32u);
+  // the moved from value may be empty, which get() must not assume away
+  ASSERT_EQ(name.get().empty(), name.get().size() == 0);
+
+  UserName other{std::string(32, 'y')};
+  const auto value = std::move(other).get();
+  ASSERT_EQ(value.size(), 32u);
+  ASSERT_EQ(other.get().empty(), other.get().size() == 0);
+}
+
+TEST(StrongValidation, bulk_range_validation) {
+  for (const std::size_t size : {0, 1, 7, 16, 17, 63, 64, 100, 1000}) {
+    std::vector<int> raw(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      raw[i] = static_cast<int>(i % 101);
+    }
+    ASSERT_TRUE(strong::all_valid<Percent>(raw));
+    ASSERT_EQ(strong::find_invalid<Percent>(raw), size);
+    for (std::size_t bad = 0; bad < size; bad += 5) {
+      auto copy = raw;
+      copy[bad] = bad % 2 == 0 ? -1 : 101;
+      ASSERT_EQ(strong::find_invalid<Percent>(copy), bad);
+    }
+  }
+  const std::vector<int> extremes{std::numeric_limits<int>::min(),
+                                  std::numeric_limits<int>::max()};
+  ASSERT_EQ(strong::find_invalid<Percent>(extremes), 0);
+
+  // validated once, then viewed as strong values without copying
+  const std::vector<int> column(100, 50);
+  ASSERT_TRUE(strong::all_valid<Percent>(column));
+  const auto percents = strong::as_strong_span<Percent>(strong::unchecked,
+                                                   std::span{column});
+  ASSERT_EQ(percents[99], Percent{50});
+}
+
+TEST(StrongValidation, bulk_floating_point_validation) {
+  std::vector<double> raw(37, 0.5);
+  raw[0] = 0.0;
+  raw[1] = 1.0;
+  ASSERT_TRUE(strong::all_valid<Probability>(raw));
+  raw[20] = std::nan("");
+  ASSERT_EQ(strong::find_invalid<Probability>(raw), 20);
+  raw[20] = 0.5;
+  raw[30] = std::nextafter(1.0, 2.0);
+  ASSERT_EQ(strong::find_invalid<Probability>(raw), 30);
+}
+
+TEST(StrongValidation, bulk_predicate_validation) {
+  const std::vector<unsigned> raw{2, 4, 6, 7, 8};
+  ASSERT_EQ(strong::find_invalid<Even>(raw), 3);
+  const std::vector<std::string> names{"a", "b", ""};
+  ASSERT_EQ(strong::find_invalid<UserName>(names), 2);
+}
+
+TEST(StrongValidation, bulk_custom_range_validation) {
+  // only strong::InRange is checked by its bounds alone
+  std::vector<int> raw(64, 42);
+  raw[5] = 3;
+  ASSERT_EQ(strong::find_invalid<EvenPercent>(raw), 5);
+  raw[5] = 4;
+  ASSERT_TRUE(strong::all_valid<EvenPercent>(raw));
+}